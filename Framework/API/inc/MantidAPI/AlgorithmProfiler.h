@@ -0,0 +1,135 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/DllConfig.h"
+#include "MantidKernel/ConfigPropertyObserver.h"
+#include "MantidKernel/SingletonHolder.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace API {
+class Algorithm;
+
+/// The measurements taken for a single execution of an algorithm
+struct AlgorithmProfileEvent {
+  /// The name of the algorithm
+  std::string name;
+  /// The version of the algorithm
+  int version = 0;
+  /// Unique identifier of this execution, counting from 1
+  std::size_t id = 0;
+  /// Identifier of the enclosing execution on the same thread, 0 if none
+  std::size_t parentId = 0;
+  /// Small integer identifying the thread that ran the algorithm
+  std::size_t thread = 0;
+  /// Start time in nanoseconds since the profiler was created
+  std::int64_t start = 0;
+  /// Wall-clock duration in nanoseconds
+  std::int64_t wallTime = 0;
+  /// CPU time used by the process during the execution, in seconds
+  double cpuTime = 0.;
+  /// Increase of the peak resident set size of the process, in bytes
+  std::size_t peakRSSIncrease = 0;
+  /// Total memory size of the input workspaces, in bytes
+  std::size_t inputSize = 0;
+  /// Total memory size of the output workspaces, in bytes
+  std::size_t outputSize = 0;
+  /// Number of threads available to parallel regions
+  int threads = 1;
+  /// CPU time divided by the wall-clock time available to all the threads
+  double threadUtilisation = 0.;
+};
+
+/** AlgorithmProfilerImpl : Records the executions of algorithms when enabled
+  through the algorithms.profiling.enabled configuration key, which may be
+  changed at runtime. Each execution records its parent on the same thread,
+  its wall-clock and CPU time, the growth of the peak memory use and the sizes
+  of its input and output workspaces. The records can be written out in the
+  Chrome trace event format, which chrome://tracing and Perfetto display as a
+  timeline; this is done on exit to the file named by
+  algorithms.profiling.filename, if it is set.
+*/
+class MANTID_API_DLL AlgorithmProfilerImpl {
+public:
+  /// Times and records the execution of an algorithm over its lifetime
+  class MANTID_API_DLL Scope {
+  public:
+    explicit Scope(const Algorithm &alg);
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+    ~Scope();
+
+  private:
+    const Algorithm &m_alg;
+    bool m_active;
+    AlgorithmProfileEvent m_event;
+    std::chrono::steady_clock::time_point m_start;
+    std::clock_t m_cpuStart;
+    std::size_t m_peakRSSStart;
+  };
+
+  bool isEnabled() const { return m_enabled; }
+  void setEnabled(bool enabled);
+  std::vector<AlgorithmProfileEvent> events() const;
+  void clear();
+  void writeTrace(std::ostream &os) const;
+  void writeTrace(const std::string &filename) const;
+
+private:
+  friend struct Mantid::Kernel::CreateUsingNew<AlgorithmProfilerImpl>;
+
+  /// Switches the profiler when the configuration changes
+  class EnabledObserver : public Kernel::ConfigPropertyObserver {
+  public:
+    explicit EnabledObserver(AlgorithmProfilerImpl &profiler);
+
+  protected:
+    void onPropertyValueChanged(const std::string &newValue,
+                                const std::string &prevValue) override;
+
+  private:
+    AlgorithmProfilerImpl &m_profiler;
+  };
+
+  AlgorithmProfilerImpl();
+  ~AlgorithmProfilerImpl();
+  AlgorithmProfilerImpl(const AlgorithmProfilerImpl &) = delete;
+  AlgorithmProfilerImpl &operator=(const AlgorithmProfilerImpl &) = delete;
+
+  std::int64_t sinceStart(std::chrono::steady_clock::time_point time) const;
+  void record(AlgorithmProfileEvent event);
+
+  std::atomic<bool> m_enabled;
+  std::atomic<std::size_t> m_nextId;
+  std::chrono::steady_clock::time_point m_start;
+  std::unique_ptr<EnabledObserver> m_observer;
+  mutable std::mutex m_mutex;
+  std::vector<AlgorithmProfileEvent> m_events;
+};
+
+using AlgorithmProfiler =
+    Mantid::Kernel::SingletonHolder<AlgorithmProfilerImpl>;
+
+} // namespace API
+} // namespace Mantid
+
+namespace Mantid {
+namespace Kernel {
+EXTERN_MANTID_API template class MANTID_API_DLL
+    Mantid::Kernel::SingletonHolder<Mantid::API::AlgorithmProfilerImpl>;
+}
+} // namespace Mantid
@@ -8,6 +8,7 @@
 #include "MantidAPI/ADSValidator.h"
 #include "MantidAPI/AlgorithmHistory.h"
 #include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/AlgorithmProfiler.h"
 #include "MantidAPI/AlgorithmProxy.h"
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/DeprecatedAlgorithm.h"
@@ -624,8 +625,11 @@ bool Algorithm::executeInternal() {
       }
 
       startTime = Mantid::Types::Core::DateAndTime::getCurrentTime();
-      // Call the concrete algorithm's exec method
-      this->exec(executionMode);
+      {
+        AlgorithmProfilerImpl::Scope profile(*this);
+        // Call the concrete algorithm's exec method
+        this->exec(executionMode);
+      }
       registerFeatureUsage();
       // Check for a cancellation request in case the concrete algorithm doesn't
       interruption_point();
@@ -1063,11 +1067,14 @@ void Algorithm::trackAlgorithmHistory(
   m_parentHistory = parentHist;
 }
 
-/** Check if we are tracking history for this algorithm
+/** Check if we are tracking history for this algorithm. A child algorithm
+ * only records its history when there is a parent history to attach it to,
+ * as it would be discarded otherwise. This avoids building history records,
+ * and those of any nested child algorithms, for nothing.
  *  @return if we are tracking the history of this algorithm
  */
 bool Algorithm::trackingHistory() {
-  return (!isChild() || m_recordHistoryForChild);
+  return (!isChild() || (m_recordHistoryForChild && m_parentHistory));
 }
 
 /** Populate lists of the workspace properties for a given direction
@@ -0,0 +1,242 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/AlgorithmProfiler.h"
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/IWorkspaceProperty.h"
+#include "MantidAPI/Workspace.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/Memory.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <stdexcept>
+
+namespace Mantid {
+namespace API {
+namespace {
+/// static logger
+Kernel::Logger g_log("AlgorithmProfiler");
+
+const std::string ENABLED_KEY("algorithms.profiling.enabled");
+const std::string FILENAME_KEY("algorithms.profiling.filename");
+
+/// Source of the small integers identifying threads in the trace
+std::atomic<std::size_t> g_nextThread{1};
+
+/// Small integer identifying the calling thread
+std::size_t threadNumber() {
+  thread_local const std::size_t number = g_nextThread++;
+  return number;
+}
+
+/// Identifiers of the executions currently running on the calling thread
+std::vector<std::size_t> &openExecutions() {
+  thread_local std::vector<std::size_t> open;
+  return open;
+}
+
+/// The peak resident set size of the process, in bytes
+std::size_t peakRSS() {
+  static const Kernel::MemoryStats stats(Kernel::MEMORY_STATS_IGNORE_SYSTEM);
+  return stats.getPeakRSS();
+}
+
+/// Sum the memory sizes of the workspaces of the properties of an algorithm
+/// going in the given direction
+std::size_t workspaceSize(const Algorithm &alg, unsigned int direction) {
+  std::size_t size = 0;
+  for (const auto *prop : alg.getProperties()) {
+    const auto wsProp = dynamic_cast<const IWorkspaceProperty *>(prop);
+    if (!wsProp || (prop->direction() != direction &&
+                    prop->direction() != Kernel::Direction::InOut))
+      continue;
+    if (const auto ws = wsProp->getWorkspace())
+      size += ws->getMemorySize();
+  }
+  return size;
+}
+
+/// Write a string as a JSON string literal
+void writeJSONString(std::ostream &os, const std::string &str) {
+  os << '"';
+  for (const char c : str) {
+    if (c == '"' || c == '\\')
+      os << '\\' << c;
+    else if (static_cast<unsigned char>(c) < 0x20)
+      os << ' ';
+    else
+      os << c;
+  }
+  os << '"';
+}
+} // namespace
+
+/** Start timing an algorithm, if the profiler is enabled
+ *  @param alg :: The algorithm about to be executed
+ */
+AlgorithmProfilerImpl::Scope::Scope(const Algorithm &alg)
+    : m_alg(alg), m_active(AlgorithmProfiler::Instance().isEnabled()),
+      m_cpuStart(0), m_peakRSSStart(0) {
+  if (!m_active)
+    return;
+  auto &profiler = AlgorithmProfiler::Instance();
+  auto &open = openExecutions();
+  m_event.name = alg.name();
+  m_event.version = alg.version();
+  m_event.id = profiler.m_nextId++;
+  m_event.parentId = open.empty() ? 0 : open.back();
+  m_event.thread = threadNumber();
+  m_event.inputSize = workspaceSize(alg, Kernel::Direction::Input);
+  m_event.threads = PARALLEL_GET_MAX_THREADS;
+  open.emplace_back(m_event.id);
+  m_peakRSSStart = peakRSS();
+  m_cpuStart = std::clock();
+  m_start = std::chrono::steady_clock::now();
+}
+
+/// Record the execution that has just finished
+AlgorithmProfilerImpl::Scope::~Scope() {
+  if (!m_active)
+    return;
+  const auto finish = std::chrono::steady_clock::now();
+  const auto cpuFinish = std::clock();
+  auto &profiler = AlgorithmProfiler::Instance();
+  openExecutions().pop_back();
+  m_event.start = profiler.sinceStart(m_start);
+  m_event.wallTime = profiler.sinceStart(finish) - m_event.start;
+  m_event.cpuTime =
+      static_cast<double>(cpuFinish - m_cpuStart) / CLOCKS_PER_SEC;
+  const auto peakRSSFinish = peakRSS();
+  m_event.peakRSSIncrease =
+      peakRSSFinish > m_peakRSSStart ? peakRSSFinish - m_peakRSSStart : 0;
+  m_event.outputSize = workspaceSize(m_alg, Kernel::Direction::Output);
+  if (m_event.wallTime > 0)
+    m_event.threadUtilisation =
+        m_event.cpuTime * 1e9 /
+        (static_cast<double>(m_event.wallTime) * m_event.threads);
+  profiler.record(std::move(m_event));
+}
+
+/// Private Constructor for singleton class
+AlgorithmProfilerImpl::AlgorithmProfilerImpl()
+    : m_enabled(false), m_nextId(1), m_start(std::chrono::steady_clock::now()),
+      m_observer(std::make_unique<EnabledObserver>(*this)) {
+  const auto enabled =
+      Kernel::ConfigService::Instance().getValue<bool>(ENABLED_KEY);
+  setEnabled(enabled.get_value_or(false));
+}
+
+/** Private destructor
+ *  Writes the recorded executions to the file given in the configuration
+ */
+AlgorithmProfilerImpl::~AlgorithmProfilerImpl() {
+  if (m_events.empty())
+    return;
+  try {
+    const auto filename =
+        Kernel::ConfigService::Instance().getString(FILENAME_KEY);
+    if (!filename.empty())
+      writeTrace(filename);
+  } catch (std::exception &) {
+    // Nothing can be reported this late on
+  }
+}
+
+/** Switch the recording of algorithm executions on or off
+ *  @param enabled :: True to record the executions that start from now on
+ */
+void AlgorithmProfilerImpl::setEnabled(bool enabled) {
+  if (m_enabled.exchange(enabled) != enabled)
+    g_log.debug() << "Algorithm profiling "
+                  << (enabled ? "enabled" : "disabled") << "\n";
+}
+
+/// @returns A copy of the recorded executions, in the order they finished
+std::vector<AlgorithmProfileEvent> AlgorithmProfilerImpl::events() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_events;
+}
+
+/// Discard the recorded executions
+void AlgorithmProfilerImpl::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_events.clear();
+}
+
+/** Write the recorded executions as Chrome trace events, with times in
+ *  microseconds
+ *  @param os :: The stream to write to
+ */
+void AlgorithmProfilerImpl::writeTrace(std::ostream &os) const {
+  const auto records = events();
+  const auto flags = os.flags();
+  const auto precision = os.precision();
+  os << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+  for (size_t i = 0; i < records.size(); ++i) {
+    const auto &event = records[i];
+    os << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+    writeJSONString(os, event.name);
+    os << ",\"cat\":\"algorithm\",\"ph\":\"X\",\"pid\":0"
+       << ",\"tid\":" << event.thread
+       << ",\"ts\":" << static_cast<double>(event.start) * 1e-3
+       << ",\"dur\":" << static_cast<double>(event.wallTime) * 1e-3
+       << ",\"args\":{\"version\":" << event.version
+       << ",\"id\":" << event.id << ",\"parent\":" << event.parentId
+       << ",\"cpu_time_ms\":" << event.cpuTime * 1e3
+       << ",\"peak_rss_increase_bytes\":" << event.peakRSSIncrease
+       << ",\"input_bytes\":" << event.inputSize
+       << ",\"output_bytes\":" << event.outputSize
+       << ",\"threads\":" << event.threads
+       << ",\"thread_utilisation\":" << event.threadUtilisation << "}}";
+  }
+  os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  os.flags(flags);
+  os.precision(precision);
+}
+
+/** Write the recorded executions as Chrome trace events to a file
+ *  @param filename :: The path of the file to write
+ *  @throws std::runtime_error if the file cannot be opened
+ */
+void AlgorithmProfilerImpl::writeTrace(const std::string &filename) const {
+  std::ofstream file(filename);
+  if (!file)
+    throw std::runtime_error("Unable to open algorithm profile file " +
+                             filename);
+  writeTrace(file);
+}
+
+/// @returns The nanoseconds elapsed between the creation of the profiler and
+/// the given time
+std::int64_t AlgorithmProfilerImpl::sinceStart(
+    std::chrono::steady_clock::time_point time) const {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(time - m_start)
+      .count();
+}
+
+/// Store the measurements of a finished execution
+void AlgorithmProfilerImpl::record(AlgorithmProfileEvent event) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_events.emplace_back(std::move(event));
+}
+
+AlgorithmProfilerImpl::EnabledObserver::EnabledObserver(
+    AlgorithmProfilerImpl &profiler)
+    : Kernel::ConfigPropertyObserver(ENABLED_KEY), m_profiler(profiler) {}
+
+void AlgorithmProfilerImpl::EnabledObserver::onPropertyValueChanged(
+    const std::string & /*newValue*/, const std::string & /*prevValue*/) {
+  const auto enabled =
+      Kernel::ConfigService::Instance().getValue<bool>(ENABLED_KEY);
+  m_profiler.setEnabled(enabled.get_value_or(false));
+}
+
+} // namespace API
+} // namespace Mantid
@@ -0,0 +1,118 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/AlgorithmProfiler.h"
+#include "MantidAPI/FrameworkManager.h"
+#include "MantidKernel/ConfigService.h"
+
+#include <sstream>
+
+using namespace Mantid::API;
+using Mantid::Kernel::ConfigService;
+
+class ProfiledChildAlgorithm : public Algorithm {
+public:
+  const std::string name() const override { return "ProfiledChild"; }
+  int version() const override { return 2; }
+  const std::string summary() const override { return "Test summary"; }
+  void init() override {}
+  void exec() override {}
+};
+
+class ProfiledParentAlgorithm : public Algorithm {
+public:
+  const std::string name() const override { return "ProfiledParent"; }
+  int version() const override { return 1; }
+  const std::string summary() const override { return "Test summary"; }
+  void init() override {}
+  void exec() override {
+    ProfiledChildAlgorithm child;
+    child.initialize();
+    child.setChild(true);
+    child.execute();
+  }
+};
+
+class AlgorithmProfilerTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static AlgorithmProfilerTest *createSuite() {
+    return new AlgorithmProfilerTest();
+  }
+  static void destroySuite(AlgorithmProfilerTest *suite) { delete suite; }
+
+  AlgorithmProfilerTest() { FrameworkManager::Instance(); }
+
+  void setUp() override { AlgorithmProfiler::Instance().clear(); }
+
+  void tearDown() override {
+    ConfigService::Instance().setString("algorithms.profiling.enabled", "0");
+    AlgorithmProfiler::Instance().clear();
+  }
+
+  void test_nothing_is_recorded_when_disabled() {
+    ConfigService::Instance().setString("algorithms.profiling.enabled", "0");
+    runParent();
+    TS_ASSERT(AlgorithmProfiler::Instance().events().empty());
+  }
+
+  void test_configuration_switches_profiling_at_runtime() {
+    auto &profiler = AlgorithmProfiler::Instance();
+    ConfigService::Instance().setString("algorithms.profiling.enabled", "1");
+    TS_ASSERT(profiler.isEnabled());
+    ConfigService::Instance().setString("algorithms.profiling.enabled", "0");
+    TS_ASSERT(!profiler.isEnabled());
+  }
+
+  void test_child_executions_record_their_parent() {
+    ConfigService::Instance().setString("algorithms.profiling.enabled", "1");
+    runParent();
+    const auto events = AlgorithmProfiler::Instance().events();
+    TS_ASSERT_EQUALS(events.size(), 2);
+    // The child finishes first
+    const auto &child = events[0];
+    const auto &parent = events[1];
+    TS_ASSERT_EQUALS(child.name, "ProfiledChild");
+    TS_ASSERT_EQUALS(child.version, 2);
+    TS_ASSERT_EQUALS(parent.name, "ProfiledParent");
+    TS_ASSERT_EQUALS(parent.parentId, 0);
+    TS_ASSERT_EQUALS(child.parentId, parent.id);
+    TS_ASSERT_EQUALS(child.thread, parent.thread);
+    TS_ASSERT_LESS_THAN_EQUALS(parent.start, child.start);
+    TS_ASSERT_LESS_THAN_EQUALS(child.start + child.wallTime,
+                               parent.start + parent.wallTime);
+    TS_ASSERT_LESS_THAN_EQUALS(1, parent.threads);
+  }
+
+  void test_writeTrace_writes_complete_events() {
+    ConfigService::Instance().setString("algorithms.profiling.enabled", "1");
+    runParent();
+    std::ostringstream trace;
+    AlgorithmProfiler::Instance().writeTrace(trace);
+    const auto json = trace.str();
+    TS_ASSERT_EQUALS(json.find("{\"traceEvents\":["), 0);
+    TS_ASSERT_DIFFERS(json.find("\"name\":\"ProfiledParent\""),
+                      std::string::npos);
+    TS_ASSERT_DIFFERS(json.find("\"name\":\"ProfiledChild\""),
+                      std::string::npos);
+    TS_ASSERT_DIFFERS(json.find("\"ph\":\"X\""), std::string::npos);
+    TS_ASSERT_DIFFERS(json.find("\"displayTimeUnit\":\"ms\"}"),
+                      std::string::npos);
+  }
+
+private:
+  void runParent() {
+    ProfiledParentAlgorithm parent;
+    parent.initialize();
+    parent.execute();
+  }
+};
@@ -194,6 +194,22 @@ public:
 
 DECLARE_ALGORITHM(IndexingAlgorithm)
 
+/**
+ * Algorithm exposing whether it records its history
+ */
+class HistoryTrackingAlgorithm : public Algorithm {
+public:
+  const std::string name() const override {
+    return "HistoryTrackingAlgorithm";
+  }
+  int version() const override { return 1; }
+  const std::string summary() const override { return "Test summary"; }
+  bool isTrackingHistory() { return trackingHistory(); }
+
+  void init() override {}
+  void exec() override {}
+};
+
 class AlgorithmTest : public CxxTest::TestSuite {
 public:
   // This pair of boilerplate methods prevent the suite being created statically
@@ -265,6 +281,21 @@ public:
     TS_ASSERT_EQUALS(false, alg.isChild());
   }
 
+  void test_child_only_tracks_history_with_a_parent_history() {
+    HistoryTrackingAlgorithm historyAlg;
+    TS_ASSERT(historyAlg.isTrackingHistory());
+    historyAlg.setChild(true);
+    TS_ASSERT(!historyAlg.isTrackingHistory());
+    historyAlg.enableHistoryRecordingForChild(true);
+    // No parent history to attach to
+    TS_ASSERT(!historyAlg.isTrackingHistory());
+    historyAlg.trackAlgorithmHistory(
+        boost::make_shared<AlgorithmHistory>("Parent", 1, "uuid"));
+    TS_ASSERT(historyAlg.isTrackingHistory());
+    historyAlg.enableHistoryRecordingForChild(false);
+    TS_ASSERT(!historyAlg.isTrackingHistory());
+  }
+
   void testAlwaysStoreInADSGetterSetter() {
     TS_ASSERT(alg.getAlwaysStoreInADS())
     alg.setAlwaysStoreInADS(false);
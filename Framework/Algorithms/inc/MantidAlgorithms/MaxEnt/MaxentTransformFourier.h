@@ -9,11 +9,15 @@
 #include "MantidAlgorithms/MaxEnt/MaxentSpace.h"
 #include "MantidAlgorithms/MaxEnt/MaxentTransform.h"
 
+#include <memory>
+
 namespace Mantid {
 namespace Algorithms {
 
 /** MaxentTransformFourier : Defines a transformation from data space to image
   space (and vice-versa) where spaces are related by a **1D** Fourier Transform.
+  The GSL wavetable and workspace are kept between transforms of the same
+  length, so an instance should only be used by one thread at a time.
 */
 class MANTID_ALGORITHMS_DLL MaxentTransformFourier : public MaxentTransform {
 public:
@@ -22,14 +26,22 @@ public:
   // Constructor
   MaxentTransformFourier(MaxentSpace_sptr dataSpace,
                          MaxentSpace_sptr imageSpace);
+  // Destructor
+  ~MaxentTransformFourier() override;
   // Transfoms form image space to data space
   std::vector<double> imageToData(const std::vector<double> &image) override;
   // Transforms from data space to image space
   std::vector<double> dataToImage(const std::vector<double> &data) override;
 
 private:
+  class FourierPlan;
+  // Returns the plan for complex transforms of n points
+  FourierPlan &plan(size_t n);
+
   MaxentSpace_sptr m_dataSpace;
   MaxentSpace_sptr m_imageSpace;
+  /// The plan of the last transform, reused while the length is unchanged
+  std::unique_ptr<FourierPlan> m_plan;
 };
 
 } // namespace Algorithms
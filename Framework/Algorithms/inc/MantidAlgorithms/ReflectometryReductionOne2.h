@@ -98,21 +98,38 @@ private:
   // Do the reduction by summation in Q
   Mantid::API::MatrixWorkspace_sptr
   sumInQ(API::MatrixWorkspace_sptr detectorWS);
+  /// Factors projecting the corners of a pixel's bins onto twoThetaR
+  struct LambdaProjection {
+    /// The angle of the centre of the pixel
+    double twoTheta;
+    /// Factor for the lower lambda corner of a bin
+    double factor1;
+    /// Factor for the upper lambda corner of a bin
+    double factor2;
+  };
+  // Get the factors projecting a pixel onto twoThetaR
+  LambdaProjection getLambdaProjection(const double twoTheta,
+                                       const double bTwoTheta,
+                                       const double twoThetaRVal,
+                                       const bool outerCorners = true);
+  // Get the projections of all the pixels in a detector group
+  std::vector<LambdaProjection>
+  getLambdaProjections(const std::vector<size_t> &detectors);
   // Do the summation in Q for a single input value
-  void sumInQProcessValue(const int inputIdx, const double twoTheta,
-                          const double bTwoTheta,
+  void sumInQProcessValue(const int inputIdx,
+                          const LambdaProjection &projection,
                           const HistogramData::HistogramX &inputX,
                           const HistogramData::HistogramY &inputY,
                           const HistogramData::HistogramE &inputE,
-                          const std::vector<size_t> &detectors,
-                          const size_t outSpecIdx,
-                          API::MatrixWorkspace_sptr IvsLam,
+                          const HistogramData::HistogramX &outputX,
+                          std::vector<double> &outputY,
                           std::vector<double> &outputE);
   // Share counts to a projected value for summation in Q
   void sumInQShareCounts(const double inputCounts, const double inputErr,
                          const double bLambda, const double lambdaMin,
-                         const double lambdaMax, const size_t outSpecIdx,
-                         API::MatrixWorkspace_sptr IvsLam,
+                         const double lambdaMax,
+                         const HistogramData::HistogramX &outputX,
+                         std::vector<double> &outputY,
                          std::vector<double> &outputE);
   void findWavelengthMinMax(API::MatrixWorkspace_sptr inputWS);
   // Construct the output workspace
@@ -131,6 +148,9 @@ private:
                                const std::vector<size_t> &detectors,
                                double &lambdaTop, double &lambdaBot,
                                const bool outerCorners = true);
+  void projectLambdaRange(const double lambda, const double bLambda,
+                          const LambdaProjection &projection,
+                          double &lambdaVMin, double &lambdaVMax);
   // Check whether two spectrum maps match
   void verifySpectrumMaps(API::MatrixWorkspace_const_sptr ws1,
                           API::MatrixWorkspace_const_sptr ws2);
@@ -51,6 +51,12 @@ public:
                  Mantid::API::ISpectrum &attenuationFactorsSpectrum);
 
 private:
+  void generateTracks(Kernel::PseudoRandomNumberGenerator &rng,
+                      const Kernel::V3D &finalPos,
+                      const Geometry::BoundingBox &scatterBounds,
+                      Geometry::Track &beforeScatter,
+                      Geometry::Track &afterScatter);
+
   const IBeamProfile &m_beamProfile;
   MCInteractionVolume m_scatterVol;
   const size_t m_nevents;
@@ -54,6 +54,11 @@ public:
   double calculateAbsorption(const Geometry::Track &beforeScatter,
                              const Geometry::Track &afterScatter,
                              double lambdaBefore, double lambdaAfter) const;
+  void calculateAbsorption(const Geometry::Track &beforeScatter,
+                           const Geometry::Track &afterScatter,
+                           const std::vector<double> &lambdasBefore,
+                           const std::vector<double> &lambdasAfter,
+                           std::vector<double> &attenuationFactors) const;
   void generateScatterPointStats();
   Kernel::V3D generatePoint(Kernel::PseudoRandomNumberGenerator &rng);
 
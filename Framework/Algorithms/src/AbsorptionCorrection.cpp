@@ -213,6 +213,16 @@ void AbsorptionCorrection::exec() {
         "Failed to define any initial scattering gauge volume for geometry");
   }
 
+  // The bins at which the integration is carried out, the others are
+  // interpolated. Make certain that last point is calculated.
+  std::vector<size_t> lambdaIndexes;
+  for (int64_t j = 0; j < specSize; j = j + m_xStep) {
+    lambdaIndexes.emplace_back(static_cast<size_t>(j));
+    if (m_xStep > 1 && j + m_xStep >= specSize && j + 1 != specSize) {
+      j = specSize - m_xStep - 1;
+    }
+  }
+
   const auto &spectrumInfo = m_inputWS->spectrumInfo();
   Progress prog(this, 0.0, 1.0, numHists);
   // Loop over the spectra
@@ -252,29 +262,38 @@ void AbsorptionCorrection::exec() {
     const auto linearCoefAbs =
         m_material.linearAbsorpCoef(wavelengths.cbegin(), wavelengths.cend());
 
-    // Get a reference to the Y's in the output WS for storing the factors
-    auto &Y = correctionFactors->mutableY(i);
-
-    // Loop through the bins in the current spectrum every m_xStep
-    for (int64_t j = 0; j < specSize; j = j + m_xStep) {
+    // Total attenuation coefficients along the incoming and outgoing paths
+    // for all the wavelength points, so that they are integrated at once. For
+    // elastic instruments only the incoming ones are used, for the full path.
+    std::vector<double> linearCoefL1(lambdaIndexes.size());
+    std::vector<double> linearCoefL2;
+    if (m_emode != DeltaEMode::Elastic) {
+      linearCoefL2.resize(lambdaIndexes.size());
+    }
+    for (size_t k = 0; k < lambdaIndexes.size(); ++k) {
+      const double linearCoefAbsLambda = -linearCoefAbs[lambdaIndexes[k]];
       if (m_emode == DeltaEMode::Elastic) {
-        Y[j] = this->doIntegration(-linearCoefAbs[j], L2s, 0, L2s.size());
+        linearCoefL1[k] = linearCoefAbsLambda + m_linearCoefTotScatt;
       } else if (m_emode == DeltaEMode::Direct) {
-        Y[j] = this->doIntegration(linearCoefAbsFixed, -linearCoefAbs[j], L2s,
-                                   0, L2s.size());
+        linearCoefL1[k] = linearCoefAbsFixed + m_linearCoefTotScatt;
+        linearCoefL2[k] = linearCoefAbsLambda + m_linearCoefTotScatt;
       } else if (m_emode == DeltaEMode::Indirect) {
-        Y[j] = this->doIntegration(-linearCoefAbs[j], linearCoefAbsFixed, L2s,
-                                   0, L2s.size());
+        linearCoefL1[k] = linearCoefAbsLambda + m_linearCoefTotScatt;
+        linearCoefL2[k] = linearCoefAbsFixed + m_linearCoefTotScatt;
       } else { // should never happen
         throw std::runtime_error(
             "AbsorptionCorrection doesn't have a known DeltaEMode defined");
       }
-      Y[j] /= m_sampleVolume; // Divide by total volume of the shape
+    }
+    std::vector<double> integrals(lambdaIndexes.size());
+    this->doIntegration(linearCoefL1, linearCoefL2, L2s, 0, L2s.size(),
+                        integrals);
 
-      // Make certain that last point is calculated
-      if (m_xStep > 1 && j + m_xStep >= specSize && j + 1 != specSize) {
-        j = specSize - m_xStep - 1;
-      }
+    // Get a reference to the Y's in the output WS for storing the factors
+    auto &Y = correctionFactors->mutableY(i);
+    for (size_t k = 0; k < lambdaIndexes.size(); ++k) {
+      // Divide by total volume of the shape
+      Y[lambdaIndexes[k]] = integrals[k] / m_sampleVolume;
     }
 
     // Interpolate linearly between points separated by m_xStep,
@@ -476,56 +495,57 @@ void AbsorptionCorrection::calculateDistances(const IDetector &detector,
 // issues from adding lots of little numbers together
 // https://en.wikipedia.org/wiki/Pairwise_summation
 
-/// Carries out the numerical integration over the sample for elastic
-/// instruments
-double AbsorptionCorrection::doIntegration(const double linearCoefAbs,
-                                           const std::vector<double> &L2s,
-                                           const size_t startIndex,
-                                           const size_t endIndex) const {
+/// Carries out the numerical integration over the sample for all the
+/// wavelength points at once. The elements are the outer loop so that the
+/// path lengths are loaded once for all wavelengths, while each integral is
+/// still summed in the same order as one wavelength at a time.
+/// @param linearCoefL1 :: Attenuation coefficients for the incoming path, or
+/// the full path if linearCoefL2 is empty, for each wavelength point
+/// @param linearCoefL2 :: Attenuation coefficients for the outgoing path for
+/// each wavelength point, empty for elastic instruments
+/// @param L2s :: The outgoing path length for each element
+/// @param startIndex :: The first element to integrate
+/// @param endIndex :: One past the last element to integrate
+/// @param integrals :: Output integral for each wavelength point
+void AbsorptionCorrection::doIntegration(
+    const std::vector<double> &linearCoefL1,
+    const std::vector<double> &linearCoefL2, const std::vector<double> &L2s,
+    const size_t startIndex, const size_t endIndex,
+    std::vector<double> &integrals) const {
+  const size_t numLambda = linearCoefL1.size();
   if (endIndex - startIndex > MAX_INTEGRATION_LENGTH) {
     size_t middle = findMiddle(startIndex, endIndex);
 
-    return doIntegration(linearCoefAbs, L2s, startIndex, middle) +
-           doIntegration(linearCoefAbs, L2s, middle, endIndex);
-  } else {
-    double integral = 0.0;
-
-    // Iterate over all the elements, summing up the integral
-    for (size_t i = startIndex; i < endIndex; ++i) {
-      const double exponent =
-          (linearCoefAbs + m_linearCoefTotScatt) * (m_L1s[i] + L2s[i]);
-      integral += (EXPONENTIAL(exponent) * (m_elementVolumes[i]));
+    std::vector<double> upper(numLambda);
+    doIntegration(linearCoefL1, linearCoefL2, L2s, startIndex, middle,
+                  integrals);
+    doIntegration(linearCoefL1, linearCoefL2, L2s, middle, endIndex, upper);
+    for (size_t k = 0; k < numLambda; ++k) {
+      integrals[k] += upper[k];
     }
-
-    return integral;
-  }
-}
-
-/// Carries out the numerical integration over the sample for inelastic
-/// instruments
-double AbsorptionCorrection::doIntegration(const double linearCoefAbsL1,
-                                           const double linearCoefAbsL2,
-                                           const std::vector<double> &L2s,
-                                           const size_t startIndex,
-                                           const size_t endIndex) const {
-  if (endIndex - startIndex > MAX_INTEGRATION_LENGTH) {
-    size_t middle = findMiddle(startIndex, endIndex);
-
-    return doIntegration(linearCoefAbsL1, linearCoefAbsL2, L2s, startIndex,
-                         middle) +
-           doIntegration(linearCoefAbsL1, linearCoefAbsL2, L2s, middle,
-                         endIndex);
   } else {
-    double integral = 0.0;
-
-    // Iterate over all the elements, summing up the integral
-    for (size_t i = startIndex; i < endIndex; ++i) {
-      double exponent = (linearCoefAbsL1 + m_linearCoefTotScatt) * m_L1s[i];
-      exponent += (linearCoefAbsL2 + m_linearCoefTotScatt) * L2s[i];
-      integral += (EXPONENTIAL(exponent) * (m_elementVolumes[i]));
+    std::fill(integrals.begin(), integrals.end(), 0.0);
+
+    // Iterate over all the elements, summing up the integrals
+    if (linearCoefL2.empty()) {
+      for (size_t i = startIndex; i < endIndex; ++i) {
+        const double pathLength = m_L1s[i] + L2s[i];
+        const double volume = m_elementVolumes[i];
+        for (size_t k = 0; k < numLambda; ++k) {
+          integrals[k] += EXPONENTIAL(linearCoefL1[k] * pathLength) * volume;
+        }
+      }
+    } else {
+      for (size_t i = startIndex; i < endIndex; ++i) {
+        const double L1 = m_L1s[i];
+        const double L2 = L2s[i];
+        const double volume = m_elementVolumes[i];
+        for (size_t k = 0; k < numLambda; ++k) {
+          const double exponent = linearCoefL1[k] * L1 + linearCoefL2[k] * L2;
+          integrals[k] += EXPONENTIAL(exponent) * volume;
+        }
+      }
     }
-
-    return integral;
   }
 }
 
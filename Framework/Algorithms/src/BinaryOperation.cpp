@@ -23,6 +23,8 @@
 #include "MantidKernel/Unit.h"
 #include <boost/make_shared.hpp>
 
+#include <algorithm>
+
 using namespace Mantid::Geometry;
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
@@ -32,6 +34,27 @@ using std::size_t;
 
 namespace Mantid {
 namespace Algorithms {
+namespace {
+/// @returns The workspace indices of an EventWorkspace, from the spectrum
+/// with the most events to the one with the fewest
+std::vector<int64_t> spectraByDescendingEvents(const EventWorkspace &ws) {
+  const auto numHists = static_cast<int64_t>(ws.getNumberHistograms());
+  std::vector<std::pair<size_t, int64_t>> sizes;
+  sizes.reserve(numHists);
+  for (int64_t i = 0; i < numHists; ++i)
+    sizes.emplace_back(ws.getSpectrum(i).getNumberEvents(), i);
+  std::stable_sort(sizes.begin(), sizes.end(),
+                   [](const auto &lhs, const auto &rhs) {
+                     return lhs.first > rhs.first;
+                   });
+  std::vector<int64_t> order;
+  order.reserve(numHists);
+  for (const auto &size : sizes)
+    order.emplace_back(size.second);
+  return order;
+}
+} // namespace
+
 /** Initialisation method.
  *  Defines input and output workspaces
  *
@@ -675,13 +698,19 @@ void BinaryOperation::do2D(bool mismatchedSpectra) {
 
     if (m_erhs && !m_useHistogramForRhsEventWorkspace) {
       // ------------ The rhs is ALSO an EventWorkspace ---------------
-      // Now loop over the spectra of each one calling the virtual function
-      const int64_t numHists = m_lhs->getNumberHistograms();
-      PARALLEL_FOR_IF(Kernel::threadSafe(*m_lhs, *m_rhs, *m_out))
-      for (int64_t i = 0; i < numHists; ++i) {
+      // Now loop over the spectra of each one calling the virtual function.
+      // The cost of a spectrum grows with its number of events, so hand the
+      // spectra out one at a time starting with the largest to balance the
+      // threads.
+      const auto order = spectraByDescendingEvents(*m_eout);
+      const auto numHists = static_cast<int64_t>(order.size());
+      const bool threadSafe = Kernel::threadSafe(*m_lhs, *m_rhs, *m_out);
+      PRAGMA_OMP(parallel for schedule(dynamic, 1) if (threadSafe))
+      for (int64_t k = 0; k < numHists; ++k) {
         PARALLEL_START_INTERUPT_REGION
         m_progress->report(this->name());
 
+        const int64_t i = order[k];
         int64_t rhs_wi = i;
         if (mismatchedSpectra && table) {
           rhs_wi = (*table)[i];
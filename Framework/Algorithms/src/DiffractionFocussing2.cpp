@@ -413,7 +413,7 @@ void DiffractionFocussing2::execEvent() {
       for (int i = wiChunk * chunkSize; i < max; i++) {
         // Accumulate the chunk
         size_t wi = indices[i];
-        chunkEL += m_eventW->getSpectrum(wi);
+        chunkEL.accumulate(m_eventW->getSpectrum(wi));
       }
 
       // Rejoin the chunk with the rest.
@@ -434,7 +434,7 @@ void DiffractionFocussing2::execEvent() {
       const std::vector<size_t> &indices = this->m_wsIndices[iGroup];
       for (auto wi : indices) {
         // In workspace index iGroup, put what was in the OLD workspace index wi
-        out->getSpectrum(iGroup) += m_eventW->getSpectrum(wi);
+        out->getSpectrum(iGroup).accumulate(m_eventW->getSpectrum(wi));
 
         prog->reportIncrement(1, "Appending Lists");
 
@@ -22,6 +22,7 @@
 #include "MantidHistogramData/LinearGenerator.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/VectorHelper.h"
 #include <algorithm>
@@ -391,15 +392,18 @@ void MaxEnt::exec() {
     imageSpace = boost::make_shared<MaxentSpaceReal>();
   }
   // The type of transform. Currently a 1D Fourier Transform or Multiple ID
-  // Fourier transform
-  MaxentTransform_sptr transform;
-  if (perSpectrumReconstruction) {
-    transform =
-        boost::make_shared<MaxentTransformFourier>(dataSpace, imageSpace);
-  } else {
+  // Fourier transform. Each spectrum gets its own transform, as transforms
+  // keep the FFT tables between calls.
+  auto createTransform = [&]() -> MaxentTransform_sptr {
+    if (perSpectrumReconstruction)
+      return boost::make_shared<MaxentTransformFourier>(dataSpace, imageSpace);
     auto complexDataSpace = boost::make_shared<MaxentSpaceComplex>();
-    transform = boost::make_shared<MaxentTransformMultiFourier>(
+    return boost::make_shared<MaxentTransformMultiFourier>(
         complexDataSpace, imageSpace, nHist / 2);
+  };
+  if (!complexData && !perSpectrumReconstruction) {
+    throw std::invalid_argument(
+        "ComplexData must be true, if PerSpectrumReconstruction is false.");
   }
 
   // The type of entropy we are going to use (depends on the type of image,
@@ -411,9 +415,6 @@ void MaxEnt::exec() {
     entropy = boost::make_shared<MaxentEntropyNegativeValues>();
   }
 
-  // Entropy and transform is all we need to set up a calculator
-  MaxentCalculator maxentCalculator = MaxentCalculator(entropy, transform);
-
   // Output workspaces
   MatrixWorkspace_sptr outImageWS;
   MatrixWorkspace_sptr outDataWS;
@@ -442,14 +443,25 @@ void MaxEnt::exec() {
   outEvolTest = create<MatrixWorkspace>(*inWS, nImageSpec, Points(nIter));
 
   npoints = complexImage ? npoints * 2 : npoints;
-  std::vector<size_t> iterationCounts;
-  iterationCounts.reserve(nImageSpec);
+  // If a spectrum doesn't converge, all the iterations are recorded
+  std::vector<size_t> iterationCounts(nImageSpec, nIter);
   outEvolChi->setPoints(0, Points(nIter, LinearGenerator(0.0, 1.0)));
+  const auto evolX = outEvolChi->sharedX(0);
 
   size_t dataLength = complexData ? 2 * inWS->y(0).size() : inWS->y(0).size();
   dataLength *= nSpecConcat;
 
-  for (size_t spec = 0; spec < nImageSpec; spec++) {
+  // Progress
+  Progress progress(this, 0.0, 1.0, nImageSpec * nIter);
+
+  // The spectra are reconstructed independently of each other
+  PARALLEL_FOR_IF(Kernel::threadSafe(*inWS, *outImageWS, *outDataWS))
+  for (int64_t ispec = 0; ispec < static_cast<int64_t>(nImageSpec); ispec++) {
+    PARALLEL_START_INTERUPT_REGION
+    const auto spec = static_cast<size_t>(ispec);
+
+    // Entropy and transform is all we need to set up a calculator
+    MaxentCalculator maxentCalculator(entropy, createTransform());
 
     // Start distribution (flat background)
     std::vector<double> image(npoints, background);
@@ -462,13 +474,8 @@ void MaxEnt::exec() {
       errors = toComplex(inWS, spec, true,
                          !perSpectrumReconstruction); // 3rd arg true -> errors
     } else {
-      if (!perSpectrumReconstruction) {
-        throw std::invalid_argument(
-            "ComplexData must be true, if PerSpectrumReconstruction is false.");
-      } else {
-        data = inWS->y(spec).rawData();
-        errors = inWS->e(spec).rawData();
-      }
+      data = inWS->y(spec).rawData();
+      errors = inWS->e(spec).rawData();
     }
 
     std::vector<double> linearAdjustments;
@@ -486,11 +493,7 @@ void MaxEnt::exec() {
     std::vector<double> evolChi(nIter, 0.);
     std::vector<double> evolTest(nIter, 0.);
 
-    // Progress
-    Progress progress(this, 0.0, 1.0, nIter);
-
     // Run maxent algorithm
-    bool converged = false;
     for (size_t it = 0; it < nIter; it++) {
 
       // Iterates one step towards the solution. This means calculating
@@ -522,8 +525,7 @@ void MaxEnt::exec() {
         // it + 1 iterations have been done because we count from zero
         g_log.information()
             << "Converged after " << it + 1 << " iterations" << std::endl;
-        iterationCounts.emplace_back(it + 1);
-        converged = true;
+        iterationCounts[spec] = it + 1;
         break;
       }
 
@@ -536,32 +538,32 @@ void MaxEnt::exec() {
 
     } // Next Iteration
 
-    // If we didn't converge, we still need to record the number of iterations
-    if (!converged) {
-      iterationCounts.emplace_back(nIter);
-    }
-
     // Get calculated data
     auto solData = maxentCalculator.getReconstructedData();
     auto solImage = maxentCalculator.getImage();
 
-    // Populate the output workspaces
-    populateDataWS(inWS, spec, nDataSpec, solData, !perSpectrumReconstruction,
-                   complexData, outDataWS);
-    populateImageWS(inWS, spec, nImageSpec, solImage, complexImage, outImageWS,
-                    autoShift);
+    // Populate the output workspaces. This also sets the units of the image,
+    // so only one thread may do it at a time.
+    PARALLEL_CRITICAL(MaxEnt_populate) {
+      populateDataWS(inWS, spec, nDataSpec, solData,
+                     !perSpectrumReconstruction, complexData, outDataWS);
+      populateImageWS(inWS, spec, nImageSpec, solImage, complexImage,
+                      outImageWS, autoShift);
+    }
 
     // Populate workspaces recording the evolution of Chi and Test
     // X values
-    outEvolChi->setSharedX(spec, outEvolChi->sharedX(0));
-    outEvolTest->setSharedX(spec, outEvolChi->sharedX(0));
+    outEvolChi->setSharedX(spec, evolX);
+    outEvolTest->setSharedX(spec, evolX);
 
     // Y values
     outEvolChi->setCounts(spec, std::move(evolChi));
     outEvolTest->setCounts(spec, std::move(evolTest));
     // No errors
 
+    PARALLEL_END_INTERUPT_REGION
   } // Next spectrum
+  PARALLEL_CHECK_INTERUPT_REGION
   setProperty("EvolChi",
               removeZeros(outEvolChi, iterationCounts, "Chi squared"));
   setProperty("EvolAngle",
@@ -834,10 +836,12 @@ MaxEnt::updateImage(const std::vector<double> &image,
 
   std::vector<double> newImage = image;
 
-  // Calculate the new image
-  for (size_t i = 0; i < image.size(); i++) {
-    for (size_t k = 0; k < delta.size(); k++) {
-      newImage[i] += delta[k] * dirs[k][i];
+  // Calculate the new image, one search direction at a time so that the
+  // inner loop runs over contiguous memory
+  for (size_t k = 0; k < delta.size(); k++) {
+    const auto &dir = dirs[k];
+    for (size_t i = 0; i < image.size(); i++) {
+      newImage[i] += delta[k] * dir[i];
     }
   }
   return newImage;
@@ -11,11 +11,56 @@
 namespace Mantid {
 namespace Algorithms {
 
+/// The GSL wavetable and workspace for complex transforms of one length
+class MaxentTransformFourier::FourierPlan {
+public:
+  explicit FourierPlan(size_t n)
+      : m_n(n), m_wavetable(gsl_fft_complex_wavetable_alloc(n)),
+        m_workspace(gsl_fft_complex_workspace_alloc(n)) {}
+  ~FourierPlan() {
+    gsl_fft_complex_wavetable_free(m_wavetable);
+    gsl_fft_complex_workspace_free(m_workspace);
+  }
+  FourierPlan(const FourierPlan &) = delete;
+  FourierPlan &operator=(const FourierPlan &) = delete;
+
+  /// The number of complex points transformed
+  size_t size() const { return m_n; }
+  /// Forward transform of packed complex values, in place
+  void forward(double *data) {
+    gsl_fft_complex_forward(data, 1, m_n, m_wavetable, m_workspace);
+  }
+  /// Backward transform of packed complex values, in place
+  void inverse(double *data) {
+    gsl_fft_complex_inverse(data, 1, m_n, m_wavetable, m_workspace);
+  }
+
+private:
+  size_t m_n;
+  gsl_fft_complex_wavetable *m_wavetable;
+  gsl_fft_complex_workspace *m_workspace;
+};
+
 /** Constructor */
 MaxentTransformFourier::MaxentTransformFourier(MaxentSpace_sptr dataSpace,
                                                MaxentSpace_sptr imageSpace)
     : m_dataSpace(dataSpace), m_imageSpace(imageSpace) {}
 
+/** Destructor */
+MaxentTransformFourier::~MaxentTransformFourier() = default;
+
+/**
+ * Returns the plan for complex transforms of n points. The plan of the
+ * previous transform is reused if it has the same length.
+ * @param n : [input] The number of complex points to transform
+ * @return : The plan
+ */
+MaxentTransformFourier::FourierPlan &MaxentTransformFourier::plan(size_t n) {
+  if (!m_plan || m_plan->size() != n)
+    m_plan = std::make_unique<FourierPlan>(n);
+  return *m_plan;
+}
+
 /**
  * Transforms a 1D signal from image space to data space, performing an
  * inverse Fast Fourier Transform. See also GSL documentation on FFT.
@@ -42,11 +87,7 @@ MaxentTransformFourier::imageToData(const std::vector<double> &image) {
   }
 
   /* Backward FT */
-  gsl_fft_complex_wavetable *wavetable = gsl_fft_complex_wavetable_alloc(n / 2);
-  gsl_fft_complex_workspace *workspace = gsl_fft_complex_workspace_alloc(n / 2);
-  gsl_fft_complex_inverse(complexImage.data(), 1, n / 2, wavetable, workspace);
-  gsl_fft_complex_wavetable_free(wavetable);
-  gsl_fft_complex_workspace_free(workspace);
+  plan(n / 2).inverse(complexImage.data());
 
   return m_dataSpace->fromComplex(complexImage);
 }
@@ -77,11 +118,7 @@ MaxentTransformFourier::dataToImage(const std::vector<double> &data) {
   }
 
   /*  Fourier transofrm */
-  gsl_fft_complex_wavetable *wavetable = gsl_fft_complex_wavetable_alloc(n / 2);
-  gsl_fft_complex_workspace *workspace = gsl_fft_complex_workspace_alloc(n / 2);
-  gsl_fft_complex_forward(complexData.data(), 1, n / 2, wavetable, workspace);
-  gsl_fft_complex_wavetable_free(wavetable);
-  gsl_fft_complex_workspace_free(workspace);
+  plan(n / 2).forward(complexData.data());
 
   return m_imageSpace->fromComplex(complexData);
 }
@@ -128,32 +128,67 @@ void Rebin2D::exec() {
   const auto nreports(static_cast<size_t>(numYBins));
   m_progress = std::make_unique<API::Progress>(this, 0.0, 1.0, nreports);
 
-  PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
-  for (int64_t i = 0; i < static_cast<int64_t>(numYBins); ++i) {
-    PARALLEL_START_INTERUPT_REGION
+  // The input rows are split into contiguous chunks, several per thread and
+  // scheduled dynamically, so uneven rows do not leave threads idle. With
+  // fractional area tracking, each chunk is rebinned into its own buffer and
+  // the buffers are added to the output in chunk order, so the result does
+  // not depend on the scheduling. Every buffer is as large as the output, so
+  // for large outputs fewer chunks are used to bound the memory. A single
+  // chunk is rebinned directly into the output workspace.
+  const bool parallel = Kernel::threadSafe(*inputWS, *outputWS);
+  size_t nChunks = 1;
+  if (parallel) {
+    constexpr size_t chunksPerThread = 4;
+    const auto nThreads = static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+    nChunks = std::min(numYBins, chunksPerThread * nThreads);
+  }
+  std::vector<FractionalRebinning::FractionalRebinningBuffer> buffers;
+  if (useFractionalArea) {
+    nChunks =
+        FractionalRebinning::FractionalRebinningBuffer::maxNumberOfBuffers(
+            outputRB->getNumberHistograms(), outputRB->blocksize(), nChunks);
+    if (nChunks > 1) {
+      buffers.assign(nChunks, FractionalRebinning::FractionalRebinningBuffer(
+                                  outputRB->getNumberHistograms(),
+                                  outputRB->blocksize()));
+    }
+  }
 
-    m_progress->report("Computing polygon intersections");
-    const double vlo = oldYEdges[i];
-    const double vhi = oldYEdges[i + 1];
-    for (size_t j = 0; j < numXBins; ++j) {
-      // For each input polygon test where it intersects with
-      // the output grid and assign the appropriate weights of Y/E
-      const double x_j = oldXEdges[j];
-      const double x_jp1 = oldXEdges[j + 1];
-      Quadrilateral inputQ(x_j, x_jp1, vlo, vhi);
-      if (!useFractionalArea) {
-        FractionalRebinning::rebinToOutput(std::move(inputQ), inputWS, i, j,
-                                           *outputWS, newYBins.rawData());
-      } else {
-        FractionalRebinning::rebinToFractionalOutput(
-            std::move(inputQ), inputWS, i, j, *outputRB, newYBins.rawData(),
-            inputHasFA);
+  PRAGMA_OMP(parallel for schedule(dynamic, 1) if (nChunks > 1))
+  for (int64_t chunk = 0; chunk < static_cast<int64_t>(nChunks); ++chunk) {
+    PARALLEL_START_INTERUPT_REGION
+    const size_t chunkBegin = static_cast<size_t>(chunk) * numYBins / nChunks;
+    const size_t chunkEnd = static_cast<size_t>(chunk + 1) * numYBins / nChunks;
+    for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+      m_progress->report("Computing polygon intersections");
+      const double vlo = oldYEdges[i];
+      const double vhi = oldYEdges[i + 1];
+      for (size_t j = 0; j < numXBins; ++j) {
+        // For each input polygon test where it intersects with
+        // the output grid and assign the appropriate weights of Y/E
+        const double x_j = oldXEdges[j];
+        const double x_jp1 = oldXEdges[j + 1];
+        Quadrilateral inputQ(x_j, x_jp1, vlo, vhi);
+        if (!useFractionalArea) {
+          FractionalRebinning::rebinToOutput(std::move(inputQ), inputWS, i, j,
+                                             *outputWS, newYBins.rawData());
+        } else if (buffers.empty()) {
+          FractionalRebinning::rebinToFractionalOutput(
+              std::move(inputQ), inputWS, i, j, *outputRB, newYBins.rawData(),
+              inputHasFA);
+        } else {
+          FractionalRebinning::rebinToFractionalOutput(
+              std::move(inputQ), inputWS, i, j, *outputRB, newYBins.rawData(),
+              buffers[chunk], inputHasFA);
+        }
       }
     }
-
     PARALLEL_END_INTERUPT_REGION
   }
   PARALLEL_CHECK_INTERUPT_REGION
+  for (const auto &buffer : buffers) {
+    buffer.addTo(*outputRB);
+  }
   if (useFractionalArea) {
     FractionalRebinning::finalizeFractionalRebin(*outputRB);
     outputRB->finalize(true);
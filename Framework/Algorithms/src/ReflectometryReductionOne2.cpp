@@ -19,12 +19,14 @@
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidKernel/MandatoryValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/StringTokenizer.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/UnitFactory.h"
 
 #include <algorithm>
+#include <exception>
 
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
@@ -40,6 +42,9 @@ namespace {
 
 std::string const OUTPUT_WORKSPACE_DEFAULT_PREFIX("IvsQ");
 std::string const OUTPUT_WORKSPACE_WAVELENGTH_DEFAULT_PREFIX("IvsLam");
+// The number of pixels of a detector group projected concurrently when summing
+// in Q, which bounds the memory used for the projected spectra
+int64_t const PIXEL_BLOCK_SIZE(64);
 
 /** Get the twoTheta angle for the centre of the detector associated with the
  * given spectrum
@@ -113,6 +118,32 @@ double getBoundingBoxExtent(const BoundingBox &boundingBox,
   }
   return result;
 }
+
+/** Keeps the exception thrown by the lowest iteration of a parallel loop, so
+ * that it can be rethrown unchanged once the loop has finished. The caller
+ * then sees the same error as if the loop had run serially.
+ */
+class FirstException {
+public:
+  /// Store the exception being handled if it comes from an earlier iteration
+  void capture(const int64_t index) {
+    PARALLEL_CRITICAL(ReflectometryReductionOne2_FirstException) {
+      if (!m_exception || index < m_index) {
+        m_exception = std::current_exception();
+        m_index = index;
+      }
+    }
+  }
+  /// Rethrow the stored exception, if any
+  void rethrowIfCaptured() const {
+    if (m_exception)
+      std::rethrow_exception(m_exception);
+  }
+
+private:
+  std::exception_ptr m_exception;
+  int64_t m_index{0};
+};
 } // namespace
 
 // Register the algorithm into the AlgorithmFactory
@@ -997,6 +1028,12 @@ ReflectometryReductionOne2::constructIvsLamWS(MatrixWorkspace_sptr detectorWS) {
  * Sum counts from the input workspace in lambda along lines of constant Q by
  * projecting to "virtual lambda" at a reference angle twoThetaR.
  *
+ * Detector groups are processed in parallel. Within a group, the pixels are
+ * projected in parallel blocks into arrays of their own, which are then added
+ * to the output in pixel order so that the result does not depend on the
+ * number of threads. If any of them fails, the exception of the first group or
+ * pixel that failed is rethrown, as for a serial loop.
+ *
  * @param detectorWS [in] :: the input workspace in wavelength
  * @return :: the output workspace in wavelength
  */
@@ -1006,80 +1043,141 @@ ReflectometryReductionOne2::sumInQ(MatrixWorkspace_sptr detectorWS) {
   // Construct the output array in virtual lambda
   MatrixWorkspace_sptr IvsLam = constructIvsLamWS(detectorWS);
 
-  // Loop through each input group (and corresponding output spectrum)
-  const size_t numGroups = detectorGroups().size();
-  for (size_t groupIdx = 0; groupIdx < numGroups; ++groupIdx) {
-    auto &detectors = detectorGroups()[groupIdx];
-    auto &outputE = IvsLam->dataE(groupIdx);
-
-    // Loop through each spectrum in the detector group
+  // Find the projections of all the pixels up front. This is the only part
+  // that needs the instrument, so it is done serially
+  const auto &groups = detectorGroups();
+  const auto numGroups = static_cast<int64_t>(groups.size());
+  std::vector<std::vector<LambdaProjection>> projections;
+  projections.reserve(groups.size());
+  for (const auto &detectors : groups) {
     for (auto spIdx : detectors) {
-      // Get the angle of this detector and its size in twoTheta
-      const double twoTheta = getDetectorTwoTheta(m_spectrumInfo, spIdx);
-      const double bTwoTheta = getDetectorTwoThetaRange(spIdx);
-
       // Check X length is Y length + 1
       const auto &inputX = detectorWS->x(spIdx);
       const auto &inputY = detectorWS->y(spIdx);
-      const auto &inputE = detectorWS->e(spIdx);
       if (inputX.size() != inputY.size() + 1) {
         throw std::runtime_error(
             "Expected input workspace to be histogram data (got X len=" +
             std::to_string(inputX.size()) +
             ", Y len=" + std::to_string(inputY.size()) + ")");
       }
+    }
+    projections.emplace_back(getLambdaProjections(detectors));
+  }
 
-      // Create a vector for the projected errors for this spectrum.
-      // (Output Y values can simply be accumulated directly into the output
-      // workspace, but for error values we need to create a separate error
-      // vector for the projected errors from each input spectrum and then
-      // do an overall sum in quadrature.)
-      std::vector<double> projectedE(outputE.size(), 0.0);
-
-      // Process each value in the spectrum
-      const auto ySize = static_cast<int>(inputY.size());
-      for (int inputIdx = 0; inputIdx < ySize; ++inputIdx) {
-        // Do the summation in Q
-        sumInQProcessValue(inputIdx, twoTheta, bTwoTheta, inputX, inputY,
-                           inputE, detectors, groupIdx, IvsLam, projectedE);
+  // Loop through each input group (and corresponding output spectrum)
+  FirstException groupException;
+  PARALLEL_FOR_IF(Kernel::threadSafe(*detectorWS, *IvsLam) && numGroups > 1)
+  for (int64_t groupIdx = 0; groupIdx < numGroups; ++groupIdx) {
+    try {
+      const auto &detectors = groups[groupIdx];
+      const auto &groupProjections = projections[groupIdx];
+      const auto &outputX = IvsLam->x(groupIdx);
+      auto &outputY = IvsLam->mutableY(groupIdx);
+      auto &outputE = IvsLam->mutableE(groupIdx);
+      const size_t outSize = outputY.size();
+
+      // Output Y values could be accumulated directly into the output
+      // workspace, but for error values we need a separate error vector for
+      // the projected errors from each input spectrum and then do an overall
+      // sum in quadrature. Both are projected into arrays per pixel so that
+      // the pixels of a block can be processed concurrently
+      const auto numPixels = static_cast<int64_t>(detectors.size());
+      const int64_t blockSize = std::min(numPixels, PIXEL_BLOCK_SIZE);
+      std::vector<std::vector<double>> projectedY(blockSize);
+      std::vector<std::vector<double>> projectedE(blockSize);
+      for (int64_t blockStart = 0; blockStart < numPixels;
+           blockStart += blockSize) {
+        const int64_t blockEnd = std::min(blockStart + blockSize, numPixels);
+
+        // Process each value of each spectrum in the block
+        FirstException pixelException;
+        PARALLEL_FOR_IF(Kernel::threadSafe(*detectorWS) && numGroups == 1 &&
+                        blockEnd - blockStart > 1)
+        for (int64_t pixel = blockStart; pixel < blockEnd; ++pixel) {
+          try {
+            const auto spIdx = detectors[pixel];
+            auto &pixelY = projectedY[pixel - blockStart];
+            auto &pixelE = projectedE[pixel - blockStart];
+            pixelY.assign(outSize, 0.0);
+            pixelE.assign(outSize, 0.0);
+            const auto &inputX = detectorWS->x(spIdx);
+            const auto &inputY = detectorWS->y(spIdx);
+            const auto &inputE = detectorWS->e(spIdx);
+            const auto ySize = static_cast<int>(inputY.size());
+            for (int inputIdx = 0; inputIdx < ySize; ++inputIdx) {
+              // Do the summation in Q
+              sumInQProcessValue(inputIdx, groupProjections[pixel], inputX,
+                                 inputY, inputE, outputX, pixelY, pixelE);
+            }
+          } catch (...) {
+            pixelException.capture(pixel);
+          }
+        }
+        pixelException.rethrowIfCaptured();
+
+        // Add the counts and sum errors in quadrature
+        for (int64_t pixel = blockStart; pixel < blockEnd; ++pixel) {
+          const auto &pixelY = projectedY[pixel - blockStart];
+          const auto &pixelE = projectedE[pixel - blockStart];
+          for (size_t outIdx = 0; outIdx < outSize; ++outIdx) {
+            outputY[outIdx] += pixelY[outIdx];
+            outputE[outIdx] += pixelE[outIdx] * pixelE[outIdx];
+          }
+        }
       }
 
-      // Sum errors in quadrature
-      const auto eSize = static_cast<int>(outputE.size());
-      for (int outIdx = 0; outIdx < eSize; ++outIdx) {
-        outputE[outIdx] += projectedE[outIdx] * projectedE[outIdx];
-      }
+      // Take the square root of all the accumulated squared errors for this
+      // detector group. Assumes Gaussian errors
+      double (*rs)(double) = std::sqrt;
+      std::transform(outputE.begin(), outputE.end(), outputE.begin(), rs);
+    } catch (...) {
+      groupException.capture(groupIdx);
     }
-
-    // Take the square root of all the accumulated squared errors for this
-    // detector group. Assumes Gaussian errors
-    double (*rs)(double) = std::sqrt;
-    std::transform(outputE.begin(), outputE.end(), outputE.begin(), rs);
   }
+  groupException.rethrowIfCaptured();
 
   return IvsLam;
 }
 
+/**
+ * Get the projections onto twoThetaR of all the pixels in a detector group
+ *
+ * @param detectors [in] :: spectrum indices of the detectors of interest
+ * @return :: the projection of each detector, in the same order
+ */
+std::vector<ReflectometryReductionOne2::LambdaProjection>
+ReflectometryReductionOne2::getLambdaProjections(
+    const std::vector<size_t> &detectors) {
+  const double twoThetaRVal = twoThetaR(detectors);
+  std::vector<LambdaProjection> projections;
+  projections.reserve(detectors.size());
+  for (auto spIdx : detectors) {
+    // Get the angle of this detector and its size in twoTheta
+    const double twoTheta = getDetectorTwoTheta(m_spectrumInfo, spIdx);
+    const double bTwoTheta = getDetectorTwoThetaRange(spIdx);
+    projections.emplace_back(
+        getLambdaProjection(twoTheta, bTwoTheta, twoThetaRVal));
+  }
+  return projections;
+}
+
 /**
  * Share counts from an input value onto the projected output in virtual-lambda
  *
  * @param inputIdx [in] :: the index into the input arrays
- * @param twoTheta [in] :: the value of twotTheta for this spectrum
- * @param bTwoTheta [in] :: the size of the pixel in twoTheta
+ * @param projection [in] :: the projection of this spectrum onto twoThetaR
  * @param inputX [in] :: the input spectrum X values
  * @param inputY [in] :: the input spectrum Y values
  * @param inputE [in] :: the input spectrum E values
- * @param detectors [in] :: spectrum indices of the detectors of interest
- * @param outSpecIdx [in] :: the output spectrum index
- * @param IvsLam [in,out] :: the output workspace
+ * @param outputX [in] :: the output bin edges in virtual lambda
+ * @param outputY [in,out] :: the projected Y values
  * @param outputE [in,out] :: the projected E values
  */
 void ReflectometryReductionOne2::sumInQProcessValue(
-    const int inputIdx, const double twoTheta, const double bTwoTheta,
+    const int inputIdx, const LambdaProjection &projection,
     const HistogramX &inputX, const HistogramY &inputY,
-    const HistogramE &inputE, const std::vector<size_t> &detectors,
-    const size_t outSpecIdx, MatrixWorkspace_sptr IvsLam,
-    std::vector<double> &outputE) {
+    const HistogramE &inputE, const HistogramX &outputX,
+    std::vector<double> &outputY, std::vector<double> &outputE) {
 
   // Check whether there are any counts (if not, nothing to share)
   const double inputCounts = inputY[inputIdx];
@@ -1093,11 +1191,10 @@ void ReflectometryReductionOne2::sumInQProcessValue(
   // Project these coordinates onto the virtual-lambda output (at twoThetaR)
   double lambdaVMin = 0.0;
   double lambdaVMax = 0.0;
-  getProjectedLambdaRange(lambda, twoTheta, bLambda, bTwoTheta, detectors,
-                          lambdaVMin, lambdaVMax);
+  projectLambdaRange(lambda, bLambda, projection, lambdaVMin, lambdaVMax);
   // Share the input counts into the output array
   sumInQShareCounts(inputCounts, inputE[inputIdx], bLambda, lambdaVMin,
-                    lambdaVMax, outSpecIdx, IvsLam, outputE);
+                    lambdaVMax, outputX, outputY, outputE);
 }
 
 /**
@@ -1110,18 +1207,15 @@ void ReflectometryReductionOne2::sumInQProcessValue(
  * @param bLambda [in] :: the bin width in lambda
  * @param lambdaMin [in] :: the start of the range to share counts to
  * @param lambdaMax [in] :: the end of the range to share counts to
- * @param outSpecIdx [in] :: the spectrum index to be updated in the output
- * workspace
- * @param IvsLam [in,out] :: the output workspace
+ * @param outputX [in] :: the output bin edges
+ * @param outputY [in,out] :: the projected Y values
  * @param outputE [in,out] :: the projected E values
  */
 void ReflectometryReductionOne2::sumInQShareCounts(
     const double inputCounts, const double inputErr, const double bLambda,
-    const double lambdaMin, const double lambdaMax, const size_t outSpecIdx,
-    MatrixWorkspace_sptr IvsLam, std::vector<double> &outputE) {
+    const double lambdaMin, const double lambdaMax, const HistogramX &outputX,
+    std::vector<double> &outputY, std::vector<double> &outputE) {
   // Check that we have histogram data
-  const auto &outputX = IvsLam->dataX(outSpecIdx);
-  auto &outputY = IvsLam->dataY(outSpecIdx);
   if (outputX.size() != outputY.size() + 1) {
     throw std::runtime_error(
         "Expected output array to be histogram data (got X len=" +
@@ -1193,42 +1287,72 @@ void ReflectometryReductionOne2::getProjectedLambdaRange(
     const double lambda, const double twoTheta, const double bLambda,
     const double bTwoTheta, const std::vector<size_t> &detectors,
     double &lambdaVMin, double &lambdaVMax, const bool outerCorners) {
+  const auto projection = getLambdaProjection(
+      twoTheta, bTwoTheta, twoThetaR(detectors), outerCorners);
+  projectLambdaRange(lambda, bLambda, projection, lambdaVMin, lambdaVMax);
+}
 
-  // We cannot project pixels below the horizon angle
-  if (twoTheta <= theta0()) {
-    throw std::runtime_error(
-        "Cannot process twoTheta=" + std::to_string(twoTheta * 180.0 / M_PI) +
-        " as it is below the horizon angle=" +
-        std::to_string(theta0() * 180.0 / M_PI));
-  }
-
-  // Get the angle from twoThetaR to this detector
-  const double twoThetaRVal = twoThetaR(detectors);
+/**
+ * Get the factors which project the corners of the bins of a pixel onto the
+ * reference line at twoThetaR. These only depend on the geometry, so they can
+ * be found once for each pixel and applied to all of its bins.
+ *
+ * @param twoTheta [in] :: the twoTheta coord of the centre of the pixel
+ * @param bTwoTheta [in] :: the pixel size in twoTheta
+ * @param twoThetaRVal [in] :: the reference angle twoThetaR
+ * @param outerCorners [in] :: true to project from top-left and bottom-right
+ * corners of the pixel; false to use bottom-left and top-right
+ * @return :: the projection factors
+ */
+ReflectometryReductionOne2::LambdaProjection
+ReflectometryReductionOne2::getLambdaProjection(const double twoTheta,
+                                                const double bTwoTheta,
+                                                const double twoThetaRVal,
+                                                const bool outerCorners) {
   // Get the angle from the horizon to the reference angle
   const double delta = twoThetaRVal - theta0();
   // For outer corners use top left, bottom right; otherwise bottom left, top
   // right
-  const double lambda1 = lambda - bLambda / 2.0;
-  const double lambda2 = lambda + bLambda / 2.0;
   double twoTheta1 = twoTheta + bTwoTheta / 2.0;
   double twoTheta2 = twoTheta - bTwoTheta / 2.0;
   if (!outerCorners)
     std::swap(twoTheta1, twoTheta2);
 
-  // Calculate the projected wavelength range
-  try {
-    const double lambdaV1 =
-        lambda1 * (std::sin(delta) / std::sin(twoTheta1 - theta0()));
-    const double lambdaV2 =
-        lambda2 * (std::sin(delta) / std::sin(twoTheta2 - theta0()));
-    lambdaVMin = std::min(lambdaV1, lambdaV2);
-    lambdaVMax = std::max(lambdaV1, lambdaV2);
-  } catch (std::exception &ex) {
+  LambdaProjection projection;
+  projection.twoTheta = twoTheta;
+  projection.factor1 = std::sin(delta) / std::sin(twoTheta1 - theta0());
+  projection.factor2 = std::sin(delta) / std::sin(twoTheta2 - theta0());
+  return projection;
+}
+
+/**
+ * Project a bin of a pixel onto the reference line at twoThetaR
+ *
+ * @param lambda [in] :: the lambda coord of the centre of the bin
+ * @param bLambda [in] :: the bin size in lambda
+ * @param projection [in] :: the projection factors of the pixel
+ * @param lambdaVMin [out] :: the projected range start
+ * @param lambdaVMax [out] :: the projected range end
+ * @throws :: if the pixel is below the horizon angle
+ */
+void ReflectometryReductionOne2::projectLambdaRange(
+    const double lambda, const double bLambda,
+    const LambdaProjection &projection, double &lambdaVMin,
+    double &lambdaVMax) {
+  // We cannot project pixels below the horizon angle
+  if (projection.twoTheta <= theta0()) {
     throw std::runtime_error(
-        "Failed to project (lambda, twoTheta) = (" + std::to_string(lambda) +
-        "," + std::to_string(twoTheta * 180.0 / M_PI) + ") onto twoThetaR = " +
-        std::to_string(twoThetaRVal) + ": " + ex.what());
+        "Cannot process twoTheta=" +
+        std::to_string(projection.twoTheta * 180.0 / M_PI) +
+        " as it is below the horizon angle=" +
+        std::to_string(theta0() * 180.0 / M_PI));
   }
+
+  // Calculate the projected wavelength range
+  const double lambdaV1 = (lambda - bLambda / 2.0) * projection.factor1;
+  const double lambdaV2 = (lambda + bLambda / 2.0) * projection.factor2;
+  lambdaVMin = std::min(lambdaV1, lambdaV2);
+  lambdaVMax = std::max(lambdaV1, lambdaV2);
 }
 
 /**
@@ -11,6 +11,7 @@
 
 #include "MantidAlgorithms/SampleCorrections/RectangularBeamProfile.h"
 #include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/Track.h"
 
 namespace Mantid {
 using Kernel::DeltaEMode;
@@ -71,55 +72,50 @@ void MCAbsorptionStrategy::calculate(
   const int lambdaStepSize = nbins / m_nlambda;
   auto &attenuationFactors = attenuationFactorsSpectrum.mutableY();
 
-  for (size_t i = 0; i < m_nevents; ++i) {
-    Geometry::Track beforeScatter;
-    Geometry::Track afterScatter;
-    for (int j = 0; j < nbins; j += lambdaStepSize) {
-      size_t attempts(0);
-      do {
-        bool success = false;
-        if (m_regenerateTracksForEachLambda || j == 0) {
-          const auto neutron = m_beamProfile.generatePoint(rng, scatterBounds);
-          success = m_scatterVol.calculateBeforeAfterTrack(
-              rng, neutron.startPos, finalPos, beforeScatter, afterScatter);
-        } else {
-          success = true;
-        }
-        if (!success) {
-          ++attempts;
-        } else {
-          const double lambdaStep = lambdas[j];
-          double lambdaIn(lambdaStep), lambdaOut(lambdaStep);
-          if (m_EMode == DeltaEMode::Direct) {
-            lambdaIn = lambdaFixed;
-          } else if (m_EMode == DeltaEMode::Indirect) {
-            lambdaOut = lambdaFixed;
-          } else {
-            // elastic case already initialized
-          }
-          const double wgt = m_scatterVol.calculateAbsorption(
-              beforeScatter, afterScatter, lambdaIn, lambdaOut);
-          attenuationFactors[j] += wgt;
+  // Wavelengths of the simulated points
+  std::vector<int> simulatedIndexes;
+  std::vector<double> lambdasIn, lambdasOut;
+  for (int j = 0; j < nbins; j += lambdaStepSize) {
+    simulatedIndexes.emplace_back(j);
+    double lambdaIn(lambdas[j]), lambdaOut(lambdas[j]);
+    if (m_EMode == DeltaEMode::Direct) {
+      lambdaIn = lambdaFixed;
+    } else if (m_EMode == DeltaEMode::Indirect) {
+      lambdaOut = lambdaFixed;
+    } else {
+      // elastic case already initialized
+    }
+    lambdasIn.emplace_back(lambdaIn);
+    lambdasOut.emplace_back(lambdaOut);
 
-          // Ensure we have the last point for the interpolation
-          if (lambdaStepSize > 1 && j + lambdaStepSize >= nbins &&
-              j + 1 != nbins) {
-            j = nbins - lambdaStepSize - 1;
-          }
+    // Ensure we have the last point for the interpolation
+    if (lambdaStepSize > 1 && j + lambdaStepSize >= nbins && j + 1 != nbins) {
+      j = nbins - lambdaStepSize - 1;
+    }
+  }
 
-          break;
-        }
-        if (attempts == m_maxScatterAttempts) {
-          throw std::runtime_error("Unable to generate valid track through "
-                                   "sample interaction volume after " +
-                                   std::to_string(m_maxScatterAttempts) +
-                                   " attempts. Try increasing the maximum "
-                                   "threshold or if this does not help then "
-                                   "please check the defined shape.");
-        }
-      } while (true);
+  std::vector<double> simulatedFactors(simulatedIndexes.size(), 0.);
+  Geometry::Track beforeScatter;
+  Geometry::Track afterScatter;
+  for (size_t i = 0; i < m_nevents; ++i) {
+    if (m_regenerateTracksForEachLambda) {
+      for (size_t j = 0; j < simulatedIndexes.size(); ++j) {
+        generateTracks(rng, finalPos, scatterBounds, beforeScatter,
+                       afterScatter);
+        simulatedFactors[j] += m_scatterVol.calculateAbsorption(
+            beforeScatter, afterScatter, lambdasIn[j], lambdasOut[j]);
+      }
+    } else {
+      // The tracks do not depend on the wavelength: trace them once
+      generateTracks(rng, finalPos, scatterBounds, beforeScatter,
+                     afterScatter);
+      m_scatterVol.calculateAbsorption(beforeScatter, afterScatter, lambdasIn,
+                                       lambdasOut, simulatedFactors);
     }
   }
+  for (size_t j = 0; j < simulatedIndexes.size(); ++j) {
+    attenuationFactors[simulatedIndexes[j]] += simulatedFactors[j];
+  }
 
   m_scatterVol.generateScatterPointStats();
 
@@ -146,5 +142,33 @@ void MCAbsorptionStrategy::calculate(
   attenuationFactorsSpectrum.setHistogram(attenuationFactorsHist);
 }
 
+/**
+ * Generate the tracks before and after scattering for a random neutron,
+ * retrying until a valid pair is found
+ * @param rng A reference to a PseudoRandomNumberGenerator
+ * @param finalPos Defines the final position of the neutron
+ * @param scatterBounds The bounding box of the scattering volume
+ * @param beforeScatter Out parameter for the track before scattering
+ * @param afterScatter Out parameter for the track after scattering
+ */
+void MCAbsorptionStrategy::generateTracks(
+    Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &finalPos,
+    const Geometry::BoundingBox &scatterBounds, Geometry::Track &beforeScatter,
+    Geometry::Track &afterScatter) {
+  for (size_t attempts = 0; attempts < m_maxScatterAttempts; ++attempts) {
+    const auto neutron = m_beamProfile.generatePoint(rng, scatterBounds);
+    if (m_scatterVol.calculateBeforeAfterTrack(
+            rng, neutron.startPos, finalPos, beforeScatter, afterScatter)) {
+      return;
+    }
+  }
+  throw std::runtime_error("Unable to generate valid track through "
+                           "sample interaction volume after " +
+                           std::to_string(m_maxScatterAttempts) +
+                           " attempts. Try increasing the maximum "
+                           "threshold or if this does not help then "
+                           "please check the defined shape.");
+}
+
 } // namespace Algorithms
 } // namespace Mantid
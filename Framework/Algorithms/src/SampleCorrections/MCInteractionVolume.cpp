@@ -11,6 +11,7 @@
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidKernel/Material.h"
 #include "MantidKernel/PseudoRandomNumberGenerator.h"
+#include <cmath>
 #include <iomanip>
 
 namespace Mantid {
@@ -218,6 +219,45 @@ double MCInteractionVolume::calculateAbsorption(const Track &beforeScatter,
          calculateAttenuation(afterScatter, lambdaAfter);
 }
 
+/**
+ * Accumulate the attenuation correction factors of the volume for a set of
+ * wavelengths given a before and after track. The segments of the tracks are
+ * combined once, so that a single exponential is evaluated per wavelength.
+ * @param beforeScatter Before scatter track
+ * @param afterScatter After scatter track
+ * @param lambdasBefore Lambdas before scattering
+ * @param lambdasAfter Lambdas after scattering, one per lambda before
+ * @param attenuationFactors Absorption factors, one per lambda, to which the
+ * factors for these tracks are added
+ */
+void MCInteractionVolume::calculateAbsorption(
+    const Track &beforeScatter, const Track &afterScatter,
+    const std::vector<double> &lambdasBefore,
+    const std::vector<double> &lambdasAfter,
+    std::vector<double> &attenuationFactors) const {
+  // The attenuation exponent of a segment is linear in lambda (see
+  // Material::attenuationCoefficients), so are the sums over all segments
+  auto exponentCoefficients = [](const Track &path) {
+    double constant(0.), slope(0.);
+    for (const auto &segment : path) {
+      const auto coefficients =
+          segment.object->material().attenuationCoefficients();
+      constant += coefficients.first * segment.distInsideObject;
+      slope += coefficients.second * segment.distInsideObject;
+    }
+    return std::make_pair(constant, slope);
+  };
+
+  const auto before = exponentCoefficients(beforeScatter);
+  const auto after = exponentCoefficients(afterScatter);
+  const double constant = before.first + after.first;
+  for (size_t i = 0; i < lambdasBefore.size(); ++i) {
+    attenuationFactors[i] +=
+        std::exp(-(constant + before.second * lambdasBefore[i] +
+                   after.second * lambdasAfter[i]));
+  }
+}
+
 /**
  * Generate a string summarising which parts of the environment
  * the simulated scatter points occurred in
@@ -769,7 +769,7 @@ void SmoothNeighbours::execEvent(Mantid::DataObjects::EventWorkspace_sptr &ws) {
       // Scale it
       tmpEL *= weight;
       // Add it
-      outEL += tmpEL;
+      outEL.accumulate(tmpEL);
     }
 
     // Copy the single detector ID (of the center) and spectrum number from the
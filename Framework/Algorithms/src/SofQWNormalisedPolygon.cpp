@@ -399,68 +399,120 @@ void SofQWNormalisedPolygon::exec() {
   const auto &inputIndices = inputWS->indexInfo();
   const auto &spectrumInfo = inputWS->spectrumInfo();
 
-  PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
-  for (int64_t i = 0; i < static_cast<int64_t>(nHistos); ++i) {
-    PARALLEL_START_INTERUPT_REGION
+  // The input spectra are split into contiguous chunks, several per thread
+  // and scheduled dynamically, so masked, monitor and expensive spectra do
+  // not leave threads idle. Each chunk is rebinned into its own buffer and the
+  // buffers are added to the output in chunk order, so the result does not
+  // depend on the scheduling. Every buffer is as large as the output, so for
+  // large outputs fewer chunks are used to bound the memory. A single chunk
+  // is rebinned directly into the output workspace.
+  const bool parallel = Kernel::threadSafe(*inputWS, *outputWS);
+  size_t nChunks = 1;
+  if (parallel) {
+    constexpr size_t chunksPerThread = 4;
+    const auto nThreads = static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+    nChunks = std::min(nHistos, chunksPerThread * nThreads);
+    nChunks =
+        FractionalRebinning::FractionalRebinningBuffer::maxNumberOfBuffers(
+            outputWS->getNumberHistograms(), outputWS->blocksize(), nChunks);
+    g_log.debug() << "Rebinning in " << nChunks << " chunks\n";
+  }
+  std::vector<FractionalRebinning::FractionalRebinningBuffer> buffers;
+  if (nChunks > 1) {
+    buffers.assign(nChunks, FractionalRebinning::FractionalRebinningBuffer(
+                                outputWS->getNumberHistograms(),
+                                outputWS->blocksize()));
+  }
+  // Output Q index and detector index pairs for the spectrum-detector mapping
+  std::vector<std::vector<std::pair<size_t, size_t>>> chunkMappings(nChunks);
 
-    if (spectrumInfo.isMasked(i) || spectrumInfo.isMonitor(i)) {
-      continue;
-    }
-    const auto *det =
-        m_EmodeProperties.m_emode == 1 ? nullptr : &spectrumInfo.detector(i);
-
-    const double thetaLower = m_twoThetaLowers[i];
-    const double thetaUpper = m_twoThetaUppers[i];
-
-    const auto specNo = static_cast<specnum_t>(inputIndices.spectrumNumber(i));
-    std::stringstream logStream;
-    for (size_t j = 0; j < nEnergyBins; ++j) {
-      m_progress->report("Computing polygon intersections");
-      // For each input polygon test where it intersects with
-      // the output grid and assign the appropriate weights of Y/E
-      const double dE_j = X[j];
-      const double dE_jp1 = X[j + 1];
-
-      const double lrQ = m_EmodeProperties.q(dE_jp1, thetaLower, det);
-
-      const V2D ll(dE_j, m_EmodeProperties.q(dE_j, thetaLower, det));
-      const V2D lr(dE_jp1, lrQ);
-      const V2D ur(dE_jp1, m_EmodeProperties.q(dE_jp1, thetaUpper, det));
-      const V2D ul(dE_j, m_EmodeProperties.q(dE_j, thetaUpper, det));
-      if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
-        logStream << "Spectrum=" << specNo
-                  << ", lower theta=" << thetaLower * rad2deg
-                  << ", upper theta=" << thetaUpper * rad2deg
-                  << ". QE polygon: ll=" << ll << ", lr=" << lr << ", ur=" << ur
-                  << ", ul=" << ul << "\n";
+  PRAGMA_OMP(parallel for schedule(dynamic, 1) if (nChunks > 1))
+  for (int64_t chunk = 0; chunk < static_cast<int64_t>(nChunks); ++chunk) {
+    PARALLEL_START_INTERUPT_REGION
+    auto &chunkMapping = chunkMappings[chunk];
+    const size_t chunkBegin = static_cast<size_t>(chunk) * nHistos / nChunks;
+    const size_t chunkEnd = static_cast<size_t>(chunk + 1) * nHistos / nChunks;
+    for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+      if (spectrumInfo.isMasked(i) || spectrumInfo.isMonitor(i)) {
+        continue;
       }
+      const auto *det =
+          m_EmodeProperties.m_emode == 1 ? nullptr : &spectrumInfo.detector(i);
+
+      const double thetaLower = m_twoThetaLowers[i];
+      const double thetaUpper = m_twoThetaUppers[i];
+
+      const auto specNo =
+          static_cast<specnum_t>(inputIndices.spectrumNumber(i));
+      std::stringstream logStream;
+      // The Q of the corners on the lower energy edge of a bin are those on
+      // the upper edge of the previous bin
+      double qLower = m_EmodeProperties.q(X[0], thetaLower, det);
+      double qUpper = m_EmodeProperties.q(X[0], thetaUpper, det);
+      for (size_t j = 0; j < nEnergyBins; ++j) {
+        m_progress->report("Computing polygon intersections");
+        // For each input polygon test where it intersects with
+        // the output grid and assign the appropriate weights of Y/E
+        const double dE_j = X[j];
+        const double dE_jp1 = X[j + 1];
+
+        const double lrQ = m_EmodeProperties.q(dE_jp1, thetaLower, det);
+        const double urQ = m_EmodeProperties.q(dE_jp1, thetaUpper, det);
+
+        const V2D ll(dE_j, qLower);
+        const V2D lr(dE_jp1, lrQ);
+        const V2D ur(dE_jp1, urQ);
+        const V2D ul(dE_j, qUpper);
+        qLower = lrQ;
+        qUpper = urQ;
+        if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
+          logStream << "Spectrum=" << specNo
+                    << ", lower theta=" << thetaLower * rad2deg
+                    << ", upper theta=" << thetaUpper * rad2deg
+                    << ". QE polygon: ll=" << ll << ", lr=" << lr
+                    << ", ur=" << ur << ", ul=" << ul << "\n";
+        }
 
-      using FractionalRebinning::rebinToFractionalOutput;
-      rebinToFractionalOutput(Quadrilateral(ll, lr, ur, ul), inputWS, i, j,
-                              *outputWS, m_Qout);
+        using FractionalRebinning::rebinToFractionalOutput;
+        if (buffers.empty()) {
+          rebinToFractionalOutput(Quadrilateral(ll, lr, ur, ul), inputWS, i, j,
+                                  *outputWS, m_Qout);
+        } else {
+          rebinToFractionalOutput(Quadrilateral(ll, lr, ur, ul), inputWS, i, j,
+                                  *outputWS, m_Qout, buffers[chunk]);
+        }
 
-      // Find which q bin this point lies in
-      const MantidVec::difference_type qIndex =
-          std::upper_bound(m_Qout.begin(), m_Qout.end(), lrQ) - m_Qout.begin();
-      if (qIndex != 0 && qIndex < static_cast<int>(m_Qout.size())) {
-        // Add this spectra-detector pair to the mapping
-        PARALLEL_CRITICAL(SofQWNormalisedPolygon_spectramap) {
+        // Find which q bin this point lies in
+        const MantidVec::difference_type qIndex =
+            std::upper_bound(m_Qout.begin(), m_Qout.end(), lrQ) -
+            m_Qout.begin();
+        if (qIndex != 0 && qIndex < static_cast<int>(m_Qout.size())) {
           // Could do a more complete merge of spectrum definitions here, but
-          // historically only the ID of the first detector in the spectrum is
-          // used, so I am keeping that for now.
-          detIDMapping[qIndex - 1].add(
+          // historically only the ID of the first detector in the spectrum
+          // is used, so I am keeping that for now.
+          chunkMapping.emplace_back(
+              static_cast<size_t>(qIndex - 1),
               spectrumInfo.spectrumDefinition(i)[0].first);
         }
       }
+      if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
+        g_log.debug(logStream.str());
+      }
     }
-    if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
-      g_log.debug(logStream.str());
-    }
-
     PARALLEL_END_INTERUPT_REGION
   }
   PARALLEL_CHECK_INTERUPT_REGION
 
+  for (const auto &buffer : buffers) {
+    buffer.addTo(*outputWS);
+  }
+  for (size_t chunk = 0; chunk < nChunks; ++chunk) {
+    // Add the spectra-detector pairs to the mapping
+    for (const auto &qIndexAndDetector : chunkMappings[chunk]) {
+      detIDMapping[qIndexAndDetector.first].add(qIndexAndDetector.second);
+    }
+  }
+
   FractionalRebinning::finalizeFractionalRebin(*outputWS);
   outputWS->finalize();
   FractionalRebinning::normaliseOutput(outputWS, inputWS, m_progress.get());
@@ -637,12 +637,12 @@ void SumSpectra::execEvent(MatrixWorkspace_sptr outputWorkspace,
     }
     numSpectra++;
 
-    // Add the event lists with the operator
+    // Add the event lists, growing the output list geometrically
     const EventList &inputEL = inputWorkspace->getSpectrum(i);
     if (inputEL.empty()) {
       ++numZeros;
     }
-    outputEL += inputEL;
+    outputEL.accumulate(inputEL);
 
     progress.report();
   }
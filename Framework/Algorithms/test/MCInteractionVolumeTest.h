@@ -235,6 +235,34 @@ public:
     TS_ASSERT_DELTA(0.73100698, factorSample, 1e-8);
   }
 
+  void test_Absorption_For_Several_Wavelengths_Matches_Single_Wavelength() {
+    auto sample = createTestSample(TestSampleType::SamplePlusContainer);
+    MCInteractionVolume interactor(
+        sample, sample.getEnvironment().boundingBox(), g_log);
+    Track beforeScatter({-0.0048, 0, 0}, {-1, 0, 0});
+    beforeScatter.addLink({-0.0048, 0, 0}, {-0.005, 0, 0}, 0.0002,
+                          sample.getEnvironment().getContainer().getShape());
+    Track afterScatter({-0.0048, 0, 0}, {1, 0, 0});
+    afterScatter.addLink({-0.0048, 0, 0}, {-0.0046, 0, 0}, 0.0002,
+                         sample.getEnvironment().getContainer().getShape());
+    afterScatter.addLink({-0.0046, 0, 0}, {0.0046, 0, 0}, 0.0094,
+                         sample.getShape());
+    afterScatter.addLink({0.0046, 0, 0}, {0.005, 0, 0}, 0.0098,
+                         sample.getEnvironment().getContainer().getShape());
+    const std::vector<double> lambdasBefore{0.5, 2.5, 4.};
+    const std::vector<double> lambdasAfter{1.5, 3.5, 4.};
+    // The factors are added to the existing values
+    std::vector<double> factors(lambdasBefore.size(), 1.);
+    interactor.calculateAbsorption(beforeScatter, afterScatter, lambdasBefore,
+                                   lambdasAfter, factors);
+    for (size_t i = 0; i < factors.size(); ++i) {
+      const double expected = interactor.calculateAbsorption(
+          beforeScatter, afterScatter, lambdasBefore[i], lambdasAfter[i]);
+      TS_ASSERT_DELTA(1. + expected, factors[i], 1e-12);
+    }
+    TS_ASSERT_DELTA(0.69223681, factors[1] - 1., 1e-8);
+  }
+
   //----------------------------------------------------------------------------
   // Failure cases
   //----------------------------------------------------------------------------
@@ -58,6 +58,24 @@ public:
     }
   }
 
+  void test_transforms_of_different_lengths() {
+
+    MaxentSpace_sptr dataSpace = boost::make_shared<MaxentSpaceReal>();
+    MaxentSpace_sptr imageSpace = boost::make_shared<MaxentSpaceReal>();
+    MaxentTransformFourier transform(dataSpace, imageSpace);
+
+    // The same instance is used for several lengths, alternating between them
+    for (const size_t n : std::vector<size_t>{8, 20, 8}) {
+      std::vector<double> image(n, 1.);
+      const auto result = transform.imageToData(image);
+      TS_ASSERT_EQUALS(result.size(), n);
+      TS_ASSERT_DELTA(result[0], 1., 1e-12);
+      for (size_t i = 1; i < result.size(); i++) {
+        TS_ASSERT_DELTA(result[i], 0., 1e-12);
+      }
+    }
+  }
+
   void test_real_image_to_complex_data() {
 
     MaxentSpace_sptr dataSpace = boost::make_shared<MaxentSpaceComplex>();
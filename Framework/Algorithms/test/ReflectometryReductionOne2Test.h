@@ -656,6 +656,28 @@ public:
     TS_ASSERT_DELTA(outLam->y(0)[7], 8.306563, 1e-6);
   }
 
+  void test_sum_in_q_multiple_groups() {
+    // Groups are summed independently, so identical groups give identical
+    // spectra
+    ReflectometryReductionOne2 alg;
+    setupAlgorithm(alg, 1.5, 15.0, "2-4, 2-4");
+    alg.setProperty("SummationType", "SumInQ");
+    alg.setProperty("ReductionType", "DivergentBeam");
+    alg.setProperty("ThetaIn", 25.0);
+    alg.setProperty("IncludePartialBins", "0");
+    MatrixWorkspace_sptr outLam = runAlgorithmLam(alg, 11, 2);
+
+    for (size_t i = 0; i < 2; ++i) {
+      TS_ASSERT_DELTA(outLam->x(i)[0], 0.957564, 1e-6);
+      TS_ASSERT_DELTA(outLam->x(i)[7], 10.847649, 1e-6);
+      TS_ASSERT_DELTA(outLam->y(i)[0], 8.458467, 1e-6);
+      TS_ASSERT_DELTA(outLam->y(i)[3], 8.521195, 1e-6);
+      TS_ASSERT_DELTA(outLam->y(i)[7], 8.306563, 1e-6);
+    }
+    TS_ASSERT_EQUALS(outLam->y(0).rawData(), outLam->y(1).rawData());
+    TS_ASSERT_EQUALS(outLam->e(0).rawData(), outLam->e(1).rawData());
+  }
+
   void test_angle_correction() {
 
     ReflectometryReductionOne2 alg;
@@ -0,0 +1,128 @@
+#!/usr/bin/env python
+# Mantid Repository : https://github.com/mantidproject/mantid
+#
+# Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+#     NScD Oak Ridge National Laboratory, European Spallation Source
+#     & Institut Laue - Langevin
+# SPDX - License - Identifier: GPL - 3.0 +
+""" Compare two runs of FrameworkBenchmarks written with
+--benchmark_out=<file> --benchmark_out_format=json.
+
+A benchmark has regressed when its median time has grown by more than the
+tolerance and a Mann-Whitney U test on the repetitions says that the
+difference is significant. The script exits with a non-zero return code if
+any benchmark has regressed, causing the build to fail.
+"""
+
+import argparse
+import json
+import math
+import sys
+from collections import OrderedDict
+
+
+def read_repetitions(filename, measure):
+    """Return the repetition times of each benchmark in a results file"""
+    with open(filename) as results_file:
+        results = json.load(results_file)
+    times = OrderedDict()
+    for benchmark in results["benchmarks"]:
+        # Skip the mean, median and stddev aggregates
+        if benchmark.get("run_type", "iteration") != "iteration":
+            continue
+        name = benchmark.get("run_name", benchmark["name"])
+        times.setdefault(name, []).append(float(benchmark[measure]))
+    return times
+
+
+def median(values):
+    ordered = sorted(values)
+    middle = len(ordered) // 2
+    if len(ordered) % 2:
+        return ordered[middle]
+    return 0.5 * (ordered[middle - 1] + ordered[middle])
+
+
+def mann_whitney_p_value(first, second):
+    """Two-sided p-value of the Mann-Whitney U test, using the normal
+    approximation with a correction for ties"""
+    n1, n2 = len(first), len(second)
+    combined = sorted([(value, 0) for value in first] + [(value, 1) for value in second])
+    ranks = [0.] * len(combined)
+    tie_term = 0.
+    i = 0
+    while i < len(combined):
+        j = i
+        while j + 1 < len(combined) and combined[j + 1][0] == combined[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = 0.5 * (i + j) + 1.
+        ties = j - i + 1
+        tie_term += ties**3 - ties
+        i = j + 1
+    rank_sum = sum(rank for rank, (_, sample) in zip(ranks, combined) if sample == 0)
+    u = rank_sum - n1 * (n1 + 1) / 2.
+    n = n1 + n2
+    variance = n1 * n2 / 12. * ((n + 1) - tie_term / (n * (n - 1)))
+    if variance <= 0.:
+        return 1.
+    z = (abs(u - n1 * n2 / 2.) - 0.5) / math.sqrt(variance)
+    return math.erfc(max(z, 0.) / math.sqrt(2.))
+
+
+def compare(baseline, contender, tolerance, alpha):
+    """Print a comparison table and return the names of the regressed
+    benchmarks"""
+    regressions = []
+    print("{:<60} {:>14} {:>14} {:>9} {:>8}".format("Benchmark", "Baseline", "Contender", "Change",
+                                                    "p-value"))
+    for name, contender_times in contender.items():
+        if name not in baseline:
+            print("{:<60} {:>14} {:>14.4g}".format(name, "-", median(contender_times)))
+            continue
+        baseline_times = baseline[name]
+        before = median(baseline_times)
+        after = median(contender_times)
+        change = (after - before) / before if before > 0. else 0.
+        p_value = mann_whitney_p_value(baseline_times, contender_times)
+        regressed = change > tolerance and p_value < alpha
+        if regressed:
+            regressions.append(name)
+        print("{:<60} {:>14.4g} {:>14.4g} {:>+8.1%} {:>8.3f}{}".format(
+            name, before, after, change, p_value, "  REGRESSION" if regressed else ""))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("baseline", help="JSON results of the reference build")
+    parser.add_argument("contender", help="JSON results of the build to check")
+    parser.add_argument("--tolerance",
+                        type=float,
+                        default=0.05,
+                        help="Relative increase of the median time that is accepted (default 0.05)")
+    parser.add_argument("--alpha",
+                        type=float,
+                        default=0.05,
+                        help="Significance level of the Mann-Whitney U test (default 0.05)")
+    parser.add_argument("--measure",
+                        default="real_time",
+                        choices=["real_time", "cpu_time"],
+                        help="The time to compare (default real_time)")
+    args = parser.parse_args()
+
+    baseline = read_repetitions(args.baseline, args.measure)
+    contender = read_repetitions(args.contender, args.measure)
+    few = [name for name, times in contender.items() if len(times) < 5]
+    if few:
+        print("Warning: fewer than 5 repetitions for {}; regressions cannot be "
+              "detected reliably".format(", ".join(few)))
+    regressions = compare(baseline, contender, args.tolerance, args.alpha)
+    if regressions:
+        print("\n{} benchmark(s) regressed: {}".format(len(regressions), ", ".join(regressions)))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
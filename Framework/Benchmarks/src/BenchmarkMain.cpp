@@ -0,0 +1,28 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+/** Run the benchmarks with enough warmup and repetitions for
+ * compare_benchmarks.py to tell a regression from noise. Flags given on the
+ * command line come after the defaults and so take precedence.
+ */
+int main(int argc, char **argv) {
+  std::string repetitions("--benchmark_repetitions=10");
+  std::string warmup("--benchmark_min_warmup_time=0.5");
+  std::vector<char *> args(argv, argv + argc);
+  args.insert(args.begin() + 1, {&repetitions[0], &warmup[0]});
+  int count = static_cast<int>(args.size());
+  benchmark::Initialize(&count, args.data());
+  if (benchmark::ReportUnrecognizedArguments(count, args.data()))
+    return 1;
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,86 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/EventList.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+using namespace Mantid::DataObjects;
+using Mantid::MantidVec;
+using Mantid::Types::Event::TofEvent;
+
+namespace {
+/// An unsorted list of events with time-of-flight up to 1e5 microseconds
+EventList randomEventList(size_t numEvents) {
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<double> tof(0., 1e5);
+  std::uniform_int_distribution<int64_t> pulse(0, 1000);
+  EventList events;
+  events.reserve(numEvents);
+  for (size_t i = 0; i < numEvents; ++i)
+    events.addEventQuickly(TofEvent(tof(generator), pulse(generator)));
+  return events;
+}
+
+/// Bin edges covering the events with the given number of bins
+MantidVec binEdges(size_t numBins) {
+  MantidVec edges(numBins + 1);
+  for (size_t i = 0; i <= numBins; ++i)
+    edges[i] = 1e5 * static_cast<double>(i) / static_cast<double>(numBins);
+  return edges;
+}
+} // namespace
+
+/// Histogram sorted events; arguments: number of events, number of bins
+void BM_EventList_generateHistogram(benchmark::State &state) {
+  auto events = randomEventList(static_cast<size_t>(state.range(0)));
+  events.sortTof();
+  const auto X = binEdges(static_cast<size_t>(state.range(1)));
+  MantidVec Y, E;
+  for (auto _ : state) {
+    events.generateHistogram(X, Y, E);
+    benchmark::DoNotOptimize(Y.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EventList_generateHistogram)
+    ->Args({1 << 20, 1000})
+    ->Args({1 << 20, 100000})
+    ->Unit(benchmark::kMicrosecond);
+
+/// Sort unsorted events by time-of-flight; argument: number of events
+void BM_EventList_sortTof(benchmark::State &state) {
+  const auto source = randomEventList(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    EventList events(source);
+    state.ResumeTiming();
+    events.sortTof();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EventList_sortTof)
+    ->Arg(1 << 16)
+    ->Arg(1 << 22)
+    ->Unit(benchmark::kMillisecond);
+
+/// Compress sorted events; argument: number of events
+void BM_EventList_compressEvents(benchmark::State &state) {
+  auto events = randomEventList(static_cast<size_t>(state.range(0)));
+  events.sortTof();
+  for (auto _ : state) {
+    EventList compressed;
+    events.compressEvents(1., &compressed);
+    benchmark::DoNotOptimize(compressed.getNumberEvents());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EventList_compressEvents)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond);
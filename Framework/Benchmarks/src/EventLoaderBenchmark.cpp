@@ -0,0 +1,121 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidParallel/Communicator.h"
+#include "MantidParallel/IO/EventLoader.h"
+#include "MantidTypes/Event/TofEvent.h"
+
+#include <H5Cpp.h>
+#include <Poco/Exception.h>
+#include <Poco/File.h>
+#include <Poco/TemporaryFile.h>
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+using Mantid::Types::Event::TofEvent;
+
+namespace {
+constexpr int32_t NUM_DETECTORS = 10000;
+constexpr size_t EVENTS_PER_PULSE = 1000;
+
+template <class T>
+H5::DataSet writeDataSet(H5::Group &group, const std::string &name,
+                         const H5::PredType &type, const std::vector<T> &data) {
+  const hsize_t dims[1] = {data.size()};
+  H5::DataSpace space(1, dims);
+  auto dataSet = group.createDataSet(name, type, space);
+  dataSet.write(data.data(), type);
+  return dataSet;
+}
+
+void writeUnits(H5::DataSet &dataSet, const std::string &units) {
+  H5::StrType type(H5::PredType::C_S1, units.size());
+  auto attribute =
+      dataSet.createAttribute("units", type, H5::DataSpace(H5S_SCALAR));
+  attribute.write(type, units);
+}
+
+/** A NeXus file with a single NXevent_data group, entry/bank1_events, holding
+ * random events from NUM_DETECTORS detectors. The file is removed when the
+ * object goes out of scope.
+ */
+class SyntheticEventFile {
+public:
+  explicit SyntheticEventFile(size_t numEvents)
+      : m_filename(Poco::TemporaryFile::tempName() + ".nxs") {
+    std::mt19937 generator(1234);
+    std::uniform_int_distribution<int32_t> id(0, NUM_DETECTORS - 1);
+    std::uniform_real_distribution<float> tof(0.f, 20000.f);
+    std::vector<int32_t> eventId(numEvents);
+    std::vector<float> eventTimeOffset(numEvents);
+    for (size_t i = 0; i < numEvents; ++i) {
+      eventId[i] = id(generator);
+      eventTimeOffset[i] = tof(generator);
+    }
+    const size_t numPulses = (numEvents + EVENTS_PER_PULSE - 1) /
+                             EVENTS_PER_PULSE;
+    std::vector<uint64_t> eventIndex(numPulses);
+    std::vector<double> eventTimeZero(numPulses);
+    for (size_t i = 0; i < numPulses; ++i) {
+      eventIndex[i] = i * EVENTS_PER_PULSE;
+      eventTimeZero[i] = static_cast<double>(i) / 50.;
+    }
+
+    H5::H5File file(m_filename, H5F_ACC_TRUNC);
+    H5::Group entry = file.createGroup("entry");
+    H5::Group bank = entry.createGroup("bank1_events");
+    writeDataSet(bank, "event_id", H5::PredType::NATIVE_INT32, eventId);
+    writeDataSet(bank, "event_index", H5::PredType::NATIVE_UINT64,
+                 eventIndex);
+    auto offsets = writeDataSet(bank, "event_time_offset",
+                                H5::PredType::NATIVE_FLOAT, eventTimeOffset);
+    writeUnits(offsets, "microsecond");
+    auto pulses = writeDataSet(bank, "event_time_zero",
+                               H5::PredType::NATIVE_DOUBLE, eventTimeZero);
+    writeUnits(pulses, "second");
+  }
+
+  ~SyntheticEventFile() {
+    try {
+      Poco::File(m_filename).remove();
+    } catch (Poco::Exception &) {
+    }
+  }
+
+  const std::string &filename() const { return m_filename; }
+
+private:
+  std::string m_filename;
+};
+} // namespace
+
+/// Load the events of a synthetic NeXus file into one list per detector, as
+/// LoadEventNexus does with LoadType=MPI; argument: number of events
+void BM_EventLoader_load(benchmark::State &state) {
+  const auto numEvents = static_cast<size_t>(state.range(0));
+  const SyntheticEventFile file(numEvents);
+  std::vector<std::vector<TofEvent>> lists(NUM_DETECTORS);
+  std::vector<std::vector<TofEvent> *> eventLists;
+  for (auto &list : lists)
+    eventLists.emplace_back(&list);
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (auto &list : lists)
+      list.clear();
+    state.ResumeTiming();
+    Mantid::Parallel::IO::EventLoader::load(
+        Mantid::Parallel::Communicator{}, file.filename(), "entry",
+        {"bank1_events"}, {0}, eventLists);
+    benchmark::DoNotOptimize(lists.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          (sizeof(int32_t) + sizeof(float)));
+}
+BENCHMARK(BM_EventLoader_load)
+    ->Arg(1 << 24)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,91 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/BoxController.h"
+#include "MantidDataObjects/MDBox.h"
+#include "MantidDataObjects/MDGridBox.h"
+#include "MantidDataObjects/MDLeanEvent.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+
+using namespace Mantid::DataObjects;
+using Mantid::API::BoxController;
+using Mantid::coord_t;
+
+namespace {
+using Event = MDLeanEvent<3>;
+
+/// Events spread uniformly over the cube [0, 10)^3
+std::vector<Event> randomEvents(size_t numEvents) {
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<coord_t> position(0.f, 10.f);
+  std::vector<Event> events;
+  events.reserve(numEvents);
+  for (size_t i = 0; i < numEvents; ++i) {
+    const coord_t centers[3] = {position(generator), position(generator),
+                                position(generator)};
+    events.emplace_back(1.f, 1.f, centers);
+  }
+  return events;
+}
+
+/// A box controller splitting each box into 5x5x5 above the given threshold
+std::unique_ptr<BoxController> makeBoxController(size_t splitThreshold) {
+  auto controller = std::make_unique<BoxController>(3);
+  controller->setSplitInto(5);
+  controller->setSplitThreshold(splitThreshold);
+  controller->setMaxDepth(20);
+  return controller;
+}
+
+/// A grid box over [0, 10)^3 split once into 5x5x5 boxes
+std::unique_ptr<MDGridBox<Event, 3>> makeGridBox(BoxController &controller) {
+  MDBox<Event, 3> box(&controller);
+  for (size_t d = 0; d < 3; ++d)
+    box.setExtents(d, 0., 10.);
+  return std::make_unique<MDGridBox<Event, 3>>(&box);
+}
+} // namespace
+
+/// Add events to the boxes of a grid box without splitting them further;
+/// argument: number of events
+void BM_MDGridBox_addEvents(benchmark::State &state) {
+  const auto events = randomEvents(static_cast<size_t>(state.range(0)));
+  auto controller = makeBoxController(events.size());
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto grid = makeGridBox(*controller);
+    state.ResumeTiming();
+    grid->addEvents(events);
+    benchmark::DoNotOptimize(grid.get());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MDGridBox_addEvents)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond);
+
+/// Add events to a grid box and split every box holding more than 1000 events;
+/// argument: number of events
+void BM_MDGridBox_splitAllIfNeeded(benchmark::State &state) {
+  const auto events = randomEvents(static_cast<size_t>(state.range(0)));
+  auto controller = makeBoxController(1000);
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto grid = makeGridBox(*controller);
+    grid->addEvents(events);
+    state.ResumeTiming();
+    grid->splitAllIfNeeded(nullptr);
+    benchmark::DoNotOptimize(grid.get());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MDGridBox_splitAllIfNeeded)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,36 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidHistogramData/BinEdges.h"
+#include "MantidHistogramData/Counts.h"
+#include "MantidHistogramData/Histogram.h"
+#include "MantidHistogramData/LinearGenerator.h"
+#include "MantidHistogramData/Rebin.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace Mantid::HistogramData;
+
+/// Rebin a histogram of 1e5 bins; argument: number of output bins
+void BM_HistogramData_rebin(benchmark::State &state) {
+  constexpr size_t numBins = 100000;
+  const Histogram input(BinEdges(numBins + 1, LinearGenerator(0., 1.)),
+                        Counts(numBins, LinearGenerator(1., 0.5)));
+  const auto outputBins = static_cast<size_t>(state.range(0));
+  // Offset the output edges so that most input bins are split
+  const double width =
+      static_cast<double>(numBins - 1) / static_cast<double>(outputBins);
+  const BinEdges edges(outputBins + 1, LinearGenerator(0.3, width));
+  for (auto _ : state) {
+    auto output = rebin(input, edges);
+    benchmark::DoNotOptimize(output.y().rawData().data());
+  }
+  state.SetItemsProcessed(state.iterations() * numBins);
+}
+BENCHMARK(BM_HistogramData_rebin)
+    ->Arg(1000)
+    ->Arg(100000)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,68 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/TimeSeriesProperty.h"
+#include "MantidKernel/TimeSplitter.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <memory>
+
+using Mantid::Kernel::SplittingInterval;
+using Mantid::Kernel::TimeSeriesProperty;
+using Mantid::Types::Core::DateAndTime;
+
+namespace {
+const DateAndTime START("2020-01-01T00:00:00");
+
+/// A log oscillating between -1 and 1, with one value every 0.1 seconds
+std::unique_ptr<TimeSeriesProperty<double>> makeLog(size_t numValues) {
+  std::vector<DateAndTime> times;
+  std::vector<double> values;
+  times.reserve(numValues);
+  values.reserve(numValues);
+  for (size_t i = 0; i < numValues; ++i) {
+    times.emplace_back(START + 0.1 * static_cast<double>(i));
+    values.emplace_back(std::sin(0.01 * static_cast<double>(i)));
+  }
+  auto log = std::make_unique<TimeSeriesProperty<double>>("log");
+  log->addValues(times, values);
+  return log;
+}
+} // namespace
+
+/// Keep the middle half of a log; argument: number of values
+void BM_TimeSeriesProperty_filterByTime(benchmark::State &state) {
+  const auto numValues = static_cast<size_t>(state.range(0));
+  const auto source = makeLog(numValues);
+  const double duration = 0.1 * static_cast<double>(numValues);
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::unique_ptr<TimeSeriesProperty<double>> log(source->clone());
+    state.ResumeTiming();
+    log->filterByTime(START + 0.25 * duration, START + 0.75 * duration);
+    benchmark::DoNotOptimize(log->size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TimeSeriesProperty_filterByTime)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond);
+
+/// Find the intervals where a log is within a range; argument: number of values
+void BM_TimeSeriesProperty_makeFilterByValue(benchmark::State &state) {
+  const auto log = makeLog(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::vector<SplittingInterval> split;
+    log->makeFilterByValue(split, -0.5, 0.5);
+    benchmark::DoNotOptimize(split.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TimeSeriesProperty_makeFilterByValue)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond);
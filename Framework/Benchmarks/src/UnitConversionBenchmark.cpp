@@ -0,0 +1,63 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/Unit.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace Mantid::Kernel;
+
+namespace {
+/// Time-of-flight values from 1000 to 20000 microseconds
+std::vector<double> tofValues(size_t numValues) {
+  std::vector<double> tof(numValues);
+  for (size_t i = 0; i < numValues; ++i)
+    tof[i] = 1000. + 19000. * static_cast<double>(i) /
+                         static_cast<double>(numValues);
+  return tof;
+}
+
+/// Convert time-of-flight values to the unit given as template argument
+template <class UnitType>
+void convertFromTOF(benchmark::State &state, const int emode,
+                    const double efixed) {
+  const auto source = tofValues(static_cast<size_t>(state.range(0)));
+  UnitType unit;
+  std::vector<double> x, y;
+  for (auto _ : state) {
+    state.PauseTiming();
+    x = source;
+    state.ResumeTiming();
+    unit.fromTOF(x, y, 10., 2., 1.2, emode, efixed, 0.);
+    benchmark::DoNotOptimize(x.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+/// Convert to d-spacing; argument: number of values
+void BM_Unit_fromTOF_dSpacing(benchmark::State &state) {
+  convertFromTOF<Units::dSpacing>(state, 0, 0.);
+}
+BENCHMARK(BM_Unit_fromTOF_dSpacing)
+    ->Arg(1 << 16)
+    ->Unit(benchmark::kMicrosecond);
+
+/// Convert to wavelength; argument: number of values
+void BM_Unit_fromTOF_Wavelength(benchmark::State &state) {
+  convertFromTOF<Units::Wavelength>(state, 0, 0.);
+}
+BENCHMARK(BM_Unit_fromTOF_Wavelength)
+    ->Arg(1 << 16)
+    ->Unit(benchmark::kMicrosecond);
+
+/// Convert to energy transfer in direct geometry; argument: number of values
+void BM_Unit_fromTOF_DeltaE(benchmark::State &state) {
+  convertFromTOF<Units::DeltaE>(state, 1, 50.);
+}
+BENCHMARK(BM_Unit_fromTOF_DeltaE)
+    ->Arg(1 << 16)
+    ->Unit(benchmark::kMicrosecond);
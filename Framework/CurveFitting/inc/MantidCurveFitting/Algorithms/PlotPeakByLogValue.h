@@ -66,11 +66,11 @@ private:
   /// Set any WorkspaceIndex attributes in the fitting function
   void setWorkspaceIndexAttribute(API::IFunction_sptr fun, int wsIndex) const;
 
-  boost::shared_ptr<Algorithm> runSingleFit(bool createFitOutput,
-                                            bool outputCompositeMembers,
-                                            bool outputConvolvedMembers,
-                                            const API::IFunction_sptr &ifun,
-                                            const InputSpectraToFit &data);
+  boost::shared_ptr<Algorithm>
+  runSingleFit(bool createFitOutput, bool outputCompositeMembers,
+               bool outputConvolvedMembers, const API::IFunction_sptr &ifun,
+               const InputSpectraToFit &data,
+               std::map<std::string, std::string> &minimizerWorkspaces);
 
   double calculateLogValue(std::string logName, const InputSpectraToFit &data);
 
@@ -79,7 +79,7 @@ private:
                      const API::IFunction_sptr &ifunSingle, bool &isDataName);
 
   void appendTableRow(bool isDataName, API::ITableWorkspace_sptr &result,
-                      const API::IFunction *const ifun,
+                      const std::vector<double> &parametersAndErrors,
                       const InputSpectraToFit &data, double logValue,
                       double chi2) const;
 
@@ -95,9 +95,11 @@ private:
                                     bool isMultiDomainFunction, int i,
                                     const InputSpectraToFit &data) const;
 
-  /// Create a minimizer string based on template string provided
-  std::string getMinimizerString(const std::string &wsName,
-                                 const std::string &wsIndex);
+  /// Create a minimizer string based on template string provided, and record
+  /// the workspaces the minimizer will output
+  std::string getMinimizerString(
+      const std::string &wsName, const std::string &wsIndex,
+      std::map<std::string, std::string> &minimizerWorkspaces) const;
 
   /// Base name of output workspace
   std::string m_baseName;
@@ -33,11 +33,19 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/MandatoryValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 
 namespace {
 Mantid::Kernel::Logger g_log("PlotPeakByLogValue");
+
+/// Drop the entries left empty by inputs that could not be fitted
+template <typename T>
+void removeEmptyEntries(std::vector<boost::shared_ptr<T>> &workspaces) {
+  workspaces.erase(std::remove(workspaces.begin(), workspaces.end(), nullptr),
+                   workspaces.end());
 }
+} // namespace
 
 namespace Mantid {
 namespace CurveFitting {
@@ -207,19 +215,31 @@ void PlotPeakByLogValue::exec() {
   ITableWorkspace_sptr result =
       createResultsTable(logName, ifunSingle, isDataName);
 
+  const int nInputs = static_cast<int>(wsNames.size());
+  // Fitted parameter values interleaved with their errors, as they appear in
+  // a row of the results table. Empty if the input was not fitted.
+  std::vector<std::vector<double>> fittedParameters(nInputs);
+  std::vector<double> chi2Values(nInputs);
+  std::vector<double> logValues(nInputs);
+  // Workspaces output by the minimizer of each fit, by property name
+  std::vector<std::map<std::string, std::string>> minimizerWorkspaces(nInputs);
   std::vector<MatrixWorkspace_sptr> fitWorkspaces;
   std::vector<ITableWorkspace_sptr> parameterWorkspaces;
   std::vector<ITableWorkspace_sptr> covarianceWorkspaces;
   if (createFitOutput) {
-    covarianceWorkspaces.reserve(wsNames.size());
-    fitWorkspaces.reserve(wsNames.size());
-    parameterWorkspaces.reserve(wsNames.size());
+    covarianceWorkspaces.resize(nInputs);
+    fitWorkspaces.resize(nInputs);
+    parameterWorkspaces.resize(nInputs);
   }
 
-  double dProg = 1. / static_cast<double>(wsNames.size());
-  double Prog = 0.;
-  for (int i = 0; i < static_cast<int>(wsNames.size()); ++i) {
-    InputSpectraToFit data = wsNames[i];
+  // Individual fits are independent of each other and run concurrently. A
+  // sequential fit is seeded from the result of the previous one so it must
+  // run in order.
+  Progress prog(this, 0.0, 1.0, wsNames.size());
+  PRAGMA_OMP(parallel for schedule(dynamic, 1) if (individual))
+  for (int i = 0; i < nInputs; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    const InputSpectraToFit &data = wsNames[i];
 
     if (!data.ws) {
       g_log.warning() << "Cannot access workspace " << data.name << '\n';
@@ -237,34 +257,64 @@ void PlotPeakByLogValue::exec() {
                       initialParams, isMultiDomainFunction, i, data);
 
     auto fit = runSingleFit(createFitOutput, outputCompositeMembers,
-                            outputConvolvedMembers, ifun, data);
+                            outputConvolvedMembers, ifun, data,
+                            minimizerWorkspaces[i]);
 
     ifun = fit->getProperty("Function");
-    double chi2 = fit->getProperty("OutputChi2overDoF");
+    auto &parameters = fittedParameters[i];
+    parameters.reserve(2 * ifun->nParams());
+    for (size_t iPar = 0; iPar < ifun->nParams(); ++iPar) {
+      parameters.emplace_back(ifun->getParameter(iPar));
+      parameters.emplace_back(ifun->getError(iPar));
+    }
+    const double chi2 = fit->getProperty("OutputChi2overDoF");
+    chi2Values[i] = chi2;
 
     if (createFitOutput) {
-      MatrixWorkspace_sptr outputFitWorkspace =
-          fit->getProperty("OutputWorkspace");
-      ITableWorkspace_sptr outputParamWorkspace =
-          fit->getProperty("OutputParameters");
-      ITableWorkspace_sptr outputCovarianceWorkspace =
+      fitWorkspaces[i] = fit->getProperty("OutputWorkspace");
+      parameterWorkspaces[i] = fit->getProperty("OutputParameters");
+      covarianceWorkspaces[i] =
           fit->getProperty("OutputNormalisedCovarianceMatrix");
-      fitWorkspaces.emplace_back(outputFitWorkspace);
-      parameterWorkspaces.emplace_back(outputParamWorkspace);
-      covarianceWorkspaces.emplace_back(outputCovarianceWorkspace);
     }
     g_log.debug() << "Fit result " << fit->getPropertyValue("OutputStatus")
                   << ' ' << chi2 << '\n';
 
     // Find the log value: it is either a log-file value or
     // simply the workspace number
-    double logValue = calculateLogValue(logName, data);
-    appendTableRow(isDataName, result, ifun.get(), data, logValue, chi2);
+    logValues[i] = calculateLogValue(logName, data);
+
+    prog.report("Fitting Workspace: (" + std::to_string(i) + ") - ");
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  // Fill the output in input order so the result does not depend on the order
+  // in which the fits completed
+  const std::vector<double> *lastFitted = nullptr;
+  for (int i = 0; i < nInputs; ++i) {
+    if (fittedParameters[i].empty())
+      continue;
+    appendTableRow(isDataName, result, fittedParameters[i], wsNames[i],
+                   logValues[i], chi2Values[i]);
+    lastFitted = &fittedParameters[i];
+  }
+  for (const auto &workspaces : minimizerWorkspaces) {
+    for (const auto &workspace : workspaces)
+      m_minimizerWorkspaces[workspace.first].emplace_back(workspace.second);
+  }
+  if (createFitOutput) {
+    removeEmptyEntries(fitWorkspaces);
+    removeEmptyEntries(parameterWorkspaces);
+    removeEmptyEntries(covarianceWorkspaces);
+  }
 
-    Prog += dProg;
-    std::string current = std::to_string(i);
-    progress(Prog, ("Fitting Workspace: (" + current + ") - "));
-    interruption_point();
+  // Individual fits work on copies of the input function. Leave it holding
+  // the last fitted values as a sequential fit would.
+  if (individual && !isMultiDomainFunction && lastFitted) {
+    for (size_t k = 0; k < inputFunction->nParams(); ++k) {
+      inputFunction->setParameter(k, (*lastFitted)[2 * k]);
+      inputFunction->setError(k, (*lastFitted)[2 * k + 1]);
+    }
   }
   finaliseOutputWorkspaces(createFitOutput, fitWorkspaces, parameterWorkspaces,
                            covarianceWorkspaces);
@@ -286,6 +336,13 @@ PlotPeakByLogValue::setupFunction(bool individual, bool passWSIndexToFunction,
       }
     }
 
+  } else if (individual) {
+    // Individual fits may run concurrently so each one gets its own copy of
+    // the function, starting from the initial values
+    ifun = inputFunction->clone();
+    for (size_t k = 0; k < initialParams.size(); ++k) {
+      ifun->setParameter(k, initialParams[k]);
+    }
   } else {
     ifun = inputFunction;
   }
@@ -293,11 +350,6 @@ PlotPeakByLogValue::setupFunction(bool individual, bool passWSIndexToFunction,
     this->setWorkspaceIndexAttribute(ifun, data.i);
   }
 
-  if (individual && !isMultiDomainFunction) {
-    for (size_t k = 0; k < initialParams.size(); ++k) {
-      ifun->setParameter(k, initialParams[k]);
-    }
-  }
   return ifun;
 }
 
@@ -338,12 +390,11 @@ void PlotPeakByLogValue::finaliseOutputWorkspaces(
   }
 }
 
-void PlotPeakByLogValue::appendTableRow(bool isDataName,
-                                        ITableWorkspace_sptr &result,
-                                        const IFunction *const ifun,
-                                        const InputSpectraToFit &data,
-                                        double logValue, double chi2)
-    const { // Extract the fitted parameters and put them into the result table
+void PlotPeakByLogValue::appendTableRow(
+    bool isDataName, ITableWorkspace_sptr &result,
+    const std::vector<double> &parametersAndErrors,
+    const InputSpectraToFit &data, double logValue,
+    double chi2) const { // Put the fitted parameters into the result table
   TableRow row = result->appendRow();
   if (isDataName) {
     row << data.name;
@@ -351,8 +402,8 @@ void PlotPeakByLogValue::appendTableRow(bool isDataName,
     row << logValue;
   }
 
-  for (size_t iPar = 0; iPar < ifun->nParams(); ++iPar) {
-    row << ifun->getParameter(iPar) << ifun->getError(iPar);
+  for (const auto value : parametersAndErrors) {
+    row << value;
   }
   row << chi2;
 }
@@ -387,7 +438,8 @@ PlotPeakByLogValue::createResultsTable(const std::string &logName,
 boost::shared_ptr<Algorithm> PlotPeakByLogValue::runSingleFit(
     bool createFitOutput, bool outputCompositeMembers,
     bool outputConvolvedMembers, const IFunction_sptr &ifun,
-    const InputSpectraToFit &data) {
+    const InputSpectraToFit &data,
+    std::map<std::string, std::string> &minimizerWorkspaces) {
   g_log.debug() << "Fitting " << data.ws->getName() << " index " << data.i
                 << " with \n";
   g_log.debug() << ifun->asString() << '\n';
@@ -413,7 +465,8 @@ boost::shared_ptr<Algorithm> PlotPeakByLogValue::runSingleFit(
   fit->setPropertyValue("EndX", this->getPropertyValue("EndX"));
   fit->setProperty("IgnoreInvalidData", ignoreInvalidData);
   fit->setPropertyValue("Minimizer",
-                        this->getMinimizerString(data.name, spectrum_index));
+                        this->getMinimizerString(data.name, spectrum_index,
+                                                 minimizerWorkspaces));
   fit->setPropertyValue("CostFunction", this->getPropertyValue("CostFunction"));
   fit->setPropertyValue("MaxIterations",
                         this->getPropertyValue("MaxIterations"));
@@ -473,8 +526,9 @@ void PlotPeakByLogValue::setWorkspaceIndexAttribute(IFunction_sptr fun,
   }
 }
 
-std::string PlotPeakByLogValue::getMinimizerString(const std::string &wsName,
-                                                   const std::string &wsIndex) {
+std::string PlotPeakByLogValue::getMinimizerString(
+    const std::string &wsName, const std::string &wsIndex,
+    std::map<std::string, std::string> &minimizerWorkspaces) const {
   std::string format = getPropertyValue("Minimizer");
   std::string wsBaseName = wsName + "_" + wsIndex;
   boost::replace_all(format, "$wsname", wsName);
@@ -490,8 +544,7 @@ std::string PlotPeakByLogValue::getMinimizerString(const std::string &wsName,
     if (wsProp) {
       const std::string &wsPropValue = minimizerProp->value();
       if (!wsPropValue.empty()) {
-        const std::string &wsPropName = minimizerProp->name();
-        m_minimizerWorkspaces[wsPropName].emplace_back(wsPropValue);
+        minimizerWorkspaces[minimizerProp->name()] = wsPropValue;
       }
     }
   }
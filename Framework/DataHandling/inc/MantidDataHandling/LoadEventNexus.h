@@ -204,7 +204,11 @@ private:
   void loadEvents(API::Progress *const prog, const bool monitors);
   void createSpectraMapping(
       const std::string &nxsfile, const bool monitorsOnly,
-      const std::vector<std::string> &bankNames = std::vector<std::string>());
+      const std::vector<std::string> &bankNames = std::vector<std::string>(),
+      const std::vector<std::string> &eventBankNames =
+          std::vector<std::string>(),
+      const std::vector<std::size_t> &bankNumEvents =
+          std::vector<std::size_t>());
   void deleteBanks(EventWorkspaceCollection_sptr workspace,
                    std::vector<std::string> bankNames);
   bool hasEventMonitors();
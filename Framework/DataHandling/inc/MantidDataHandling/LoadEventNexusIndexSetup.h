@@ -33,6 +33,9 @@ public:
 
   std::pair<int32_t, int32_t> eventIDLimits() const;
 
+  void setBankEventCounts(const std::vector<std::string> &bankNames,
+                          const std::vector<size_t> &eventCounts);
+
   Indexing::IndexInfo makeIndexInfo();
   Indexing::IndexInfo makeIndexInfo(const std::vector<std::string> &bankNames);
   Indexing::IndexInfo
@@ -42,12 +45,16 @@ public:
 
 private:
   Indexing::IndexInfo filterIndexInfo(const Indexing::IndexInfo &indexInfo);
+  Indexing::IndexInfo
+  scatterByCost(const Indexing::IndexInfo &indexInfo) const;
 
   const API::MatrixWorkspace_const_sptr m_instrumentWorkspace;
   int32_t m_min;
   int32_t m_max;
   std::vector<int32_t> m_range;
   const Parallel::Communicator m_communicator;
+  /// Expected number of events for each detector index, empty if unknown.
+  std::vector<double> m_detectorCosts;
 };
 
 } // namespace DataHandling
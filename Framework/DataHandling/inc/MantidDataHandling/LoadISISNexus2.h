@@ -114,15 +114,16 @@ private:
                       Mantid::NeXus::NXEntry &entry);
   /// Load log data from the nexus file
   void loadLogs(DataObjects::Workspace2D_sptr &ws);
-  // Load a given period into the workspace
-  void loadPeriodData(int64_t period, Mantid::NeXus::NXEntry &entry,
-                      DataObjects::Workspace2D_sptr &local_workspace,
-                      bool update_spectra2det_mapping = false);
-  // Load a data block
-  void loadBlock(Mantid::NeXus::NXDataSetTyped<int> &data, int64_t blocksize,
-                 int64_t period, int64_t start, int64_t &hist,
-                 int64_t &spec_num,
-                 DataObjects::Workspace2D_sptr &local_workspace);
+  // Load consecutive periods into a workspace per period
+  void loadPeriodData(
+      int64_t period, Mantid::NeXus::NXEntry &entry,
+      const std::vector<DataObjects::Workspace2D_sptr> &periodWorkspaces,
+      bool update_spectra2det_mapping = false);
+  // Load a data block of all the periods
+  void loadBlock(
+      Mantid::NeXus::NXDataSetTyped<int> &data, int64_t blocksize,
+      int64_t period, int64_t start, int64_t &hist, int64_t &spec_num,
+      const std::vector<DataObjects::Workspace2D_sptr> &periodWorkspaces);
 
   // Create period logs
   void createPeriodLogs(int64_t period,
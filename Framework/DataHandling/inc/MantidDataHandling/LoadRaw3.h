@@ -80,6 +80,22 @@ private:
                         DataObjects::Workspace2D_sptr ws_sptr,
                         DataObjects::Workspace2D_sptr mws_sptr);
 
+  /// Where a spectrum read from the file is stored
+  struct SpectrumTarget {
+    /// The spectrum number in the file
+    specnum_t spectrum;
+    /// The workspace to store it in
+    DataObjects::Workspace2D_sptr workspace;
+    /// The workspace index to store it at
+    int64_t wsIndex;
+  };
+
+  /// read the given spectra of a period, decompressing them in parallel
+  void readSpectra(FILE *file, const int64_t period,
+                   const std::vector<SpectrumTarget> &targets);
+  /// return true if the spectrum was selected by the spectrum properties
+  bool isSpectrumSelected(specnum_t spectrum) const;
+
   /// skip all spectra in a period
   void skipPeriod(FILE *file, const int64_t &period);
   /// return true if loading a selection of periods
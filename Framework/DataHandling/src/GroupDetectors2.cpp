@@ -1107,8 +1107,8 @@ GroupDetectors2::formGroupsEvent(DataObjects::EventWorkspace_const_sptr inputWS,
     beh->mutableE(outIndex)[0] = 0.0;
     for (auto originalWI : it->second) {
       const EventList &fromEL = inputWS->getSpectrum(originalWI);
-      // Add the event lists with the operator
-      outEL += fromEL;
+      // Add the event lists, growing the output list geometrically
+      outEL.accumulate(fromEL);
 
       // detectors to add to the output spectrum
       outEL.addDetectorIDs(fromEL.getDetectorIDs());
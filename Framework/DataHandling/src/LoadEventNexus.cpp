@@ -970,7 +970,8 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
     }
   }
   //----------------- Pad Empty Pixels -------------------------------
-  createSpectraMapping(m_filename, monitors, someBanks);
+  createSpectraMapping(m_filename, monitors, someBanks, bankNames,
+                       bankNumEvents);
 
   // Set all (empty) event lists as sorted by pulse time. That way, calling
   // SortEvents will not try to sort these empty lists.
@@ -1266,13 +1267,19 @@ void LoadEventNexus::deleteBanks(EventWorkspaceCollection_sptr workspace,
  * @param nxsfile :: The name of a nexus file to load the mapping from
  * @param monitorsOnly :: Load only the monitors is true
  * @param bankNames :: An optional bank name for loading specified banks
+ * @param eventBankNames :: Optional names of the NXevent_data entries
+ * @param bankNumEvents :: Optional number of events in each NXevent_data entry,
+ * used for balancing events between MPI ranks
  */
 void LoadEventNexus::createSpectraMapping(
     const std::string &nxsfile, const bool monitorsOnly,
-    const std::vector<std::string> &bankNames) {
+    const std::vector<std::string> &bankNames,
+    const std::vector<std::string> &eventBankNames,
+    const std::vector<std::size_t> &bankNumEvents) {
   LoadEventNexusIndexSetup indexSetup(
       m_ws->getSingleHeldWorkspace(), getProperty("SpectrumMin"),
       getProperty("SpectrumMax"), getProperty("SpectrumList"), communicator());
+  indexSetup.setBankEventCounts(eventBankNames, bankNumEvents);
   if (!monitorsOnly && !bankNames.empty()) {
     if (!isDefault("SpectrumMin") || !isDefault("SpectrumMax") ||
         !isDefault("SpectrumList"))
@@ -51,6 +51,38 @@ std::pair<int32_t, int32_t> LoadEventNexusIndexSetup::eventIDLimits() const {
   return {m_min, m_max};
 }
 
+/** Set the number of events in each bank, used to balance the number of events
+ * rather than the number of spectra between MPI ranks.
+ *
+ * Events of a bank are assumed to be evenly spread over its detectors. Bank
+ * names are the names of the NXevent_data entries, i.e., the name of the bank
+ * in the instrument followed by `_events`. */
+void LoadEventNexusIndexSetup::setBankEventCounts(
+    const std::vector<std::string> &bankNames,
+    const std::vector<size_t> &eventCounts) {
+  if (m_communicator.size() == 1 || bankNames.empty())
+    return;
+  const auto &componentInfo = m_instrumentWorkspace->componentInfo();
+  const auto &instrument = m_instrumentWorkspace->getInstrument();
+  m_detectorCosts.assign(m_instrumentWorkspace->detectorInfo().size(), 0.0);
+  const std::string suffix("_events");
+  for (size_t i = 0; i < bankNames.size() && i < eventCounts.size(); ++i) {
+    auto name = bankNames[i];
+    if (name.size() > suffix.size() &&
+        name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0)
+      name.resize(name.size() - suffix.size());
+    const auto &bank = instrument->getComponentByName(name);
+    if (!bank)
+      continue;
+    const auto bankIndex = componentInfo.indexOf(bank->getComponentID());
+    const auto dets = componentInfo.detectorsInSubtree(bankIndex);
+    const auto eventsPerDetector = static_cast<double>(eventCounts[i]) /
+                                   static_cast<double>(dets.size());
+    for (const auto detIndex : dets)
+      m_detectorCosts[detIndex] += eventsPerDetector;
+  }
+}
+
 IndexInfo LoadEventNexusIndexSetup::makeIndexInfo() {
   // The default 1:1 will suffice but exclude the monitors as they are always in
   // a separate workspace
@@ -77,7 +109,7 @@ IndexInfo LoadEventNexusIndexSetup::makeIndexInfo() {
     setupConsistentSpectrumNumbers(filtered, detIDs);
   }
 
-  return scatter(filtered);
+  return scatterByCost(filtered);
 }
 
 IndexInfo LoadEventNexusIndexSetup::makeIndexInfo(
@@ -114,7 +146,7 @@ IndexInfo LoadEventNexusIndexSetup::makeIndexInfo(
   // unintended dropping of events in the loader.
   m_min = EMPTY_INT();
   m_max = EMPTY_INT();
-  return scatter(indexInfo);
+  return scatterByCost(indexInfo);
 }
 
 IndexInfo LoadEventNexusIndexSetup::makeIndexInfo(
@@ -143,7 +175,7 @@ IndexInfo LoadEventNexusIndexSetup::makeIndexInfo(
     Indexing::IndexInfo indexInfo(
         spectrumNumbers, Parallel::StorageMode::Cloned, m_communicator);
     indexInfo.setSpectrumDefinitions(std::move(spectrumDefinitions));
-    return scatter(indexInfo);
+    return scatterByCost(indexInfo);
   } else {
     SpectrumDetectorMapping mapping(spec, udet, monitors);
     auto uniqueSpectra = mapping.getSpectrumNumbers();
@@ -163,7 +195,7 @@ IndexInfo LoadEventNexusIndexSetup::makeIndexInfo(
                                               uniqueSpectra.end()),
         Parallel::StorageMode::Cloned, m_communicator);
     indexInfo.setSpectrumDefinitions(std::move(spectrumDefinitions));
-    return scatter(filterIndexInfo(indexInfo));
+    return scatterByCost(filterIndexInfo(indexInfo));
   }
 }
 
@@ -202,5 +234,22 @@ LoadEventNexusIndexSetup::filterIndexInfo(const IndexInfo &indexInfo) {
   return indexInfo;
 }
 
+/** Scatter `indexInfo`, balancing the expected number of events between ranks
+ * if the event count of the banks is known.
+ *
+ * Every spectrum has a cost of one on top of its events, such that spectra
+ * without events are still spread evenly. */
+IndexInfo
+LoadEventNexusIndexSetup::scatterByCost(const IndexInfo &indexInfo) const {
+  if (m_detectorCosts.empty() || !indexInfo.spectrumDefinitions())
+    return scatter(indexInfo);
+  const auto &spectrumDefinitions = *indexInfo.spectrumDefinitions();
+  std::vector<double> costs(spectrumDefinitions.size(), 1.0);
+  for (size_t i = 0; i < spectrumDefinitions.size(); ++i)
+    for (const auto &index : spectrumDefinitions[i])
+      costs[i] += m_detectorCosts[index.first];
+  return scatter(indexInfo, std::move(costs));
+}
+
 } // namespace DataHandling
 } // namespace Mantid
@@ -24,6 +24,7 @@
 #include "MantidKernel/ListValidator.h"
 //#include "MantidKernel/LogParser.h"
 #include "MantidKernel/LogFilter.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidKernel/UnitFactory.h"
 
@@ -46,6 +47,11 @@
 #include <vector>
 
 namespace {
+/// The detector counts are read in slabs of about this many bytes
+constexpr int64_t SLAB_BYTES = 16 * 1024 * 1024;
+/// The smallest number of spectra read from the file at once
+constexpr int64_t MIN_BLOCK_SIZE = 8;
+
 Mantid::DataHandling::DataBlockComposite
 getMonitorsFromComposite(Mantid::DataHandling::DataBlockComposite &composite,
                          Mantid::DataHandling::DataBlockComposite &monitors) {
@@ -301,7 +307,6 @@ void LoadISISNexus2::exec() {
         boost::make_shared<HistogramX>(timeBins(), timeBins() + x_length);
   }
   int64_t firstentry = (m_entrynumber > 0) ? m_entrynumber : 1;
-  loadPeriodData(firstentry, entry, local_workspace, m_load_selected_spectra);
 
   // Clone the workspace at this point to provide a base object for future
   // workspace generation.
@@ -309,10 +314,22 @@ void LoadISISNexus2::exec() {
       boost::dynamic_pointer_cast<DataObjects::Workspace2D>(
           WorkspaceFactory::Instance().create(local_workspace));
 
+  // All of the periods are loaded in a single pass over the file
+  const bool loadAllPeriods =
+      m_loadBlockInfo.getNumberOfPeriods() > 1 && m_entrynumber == 0;
+  std::vector<DataObjects::Workspace2D_sptr> periodWorkspaces{local_workspace};
+  if (loadAllPeriods) {
+    for (int p = 2; p <= m_loadBlockInfo.getNumberOfPeriods(); ++p)
+      periodWorkspaces.emplace_back(
+          boost::dynamic_pointer_cast<DataObjects::Workspace2D>(
+              WorkspaceFactory::Instance().create(period_free_workspace)));
+  }
+  loadPeriodData(firstentry, entry, periodWorkspaces, m_load_selected_spectra);
+
   createPeriodLogs(firstentry, local_workspace);
 
   WorkspaceGroup_sptr wksp_group(new WorkspaceGroup);
-  if (m_loadBlockInfo.getNumberOfPeriods() > 1 && m_entrynumber == 0) {
+  if (loadAllPeriods) {
 
     wksp_group->setTitle(local_workspace->getTitle());
 
@@ -325,9 +342,7 @@ void LoadISISNexus2::exec() {
       os << p;
       m_progress->report("Loading period " + os.str());
       if (p > 1) {
-        local_workspace = boost::dynamic_pointer_cast<DataObjects::Workspace2D>(
-            WorkspaceFactory::Instance().create(period_free_workspace));
-        loadPeriodData(p, entry, local_workspace, m_load_selected_spectra);
+        local_workspace = periodWorkspaces[p - 1];
         createPeriodLogs(p, local_workspace);
         // Check consistency of logs data for multi-period workspaces and raise
         // warnings where necessary.
@@ -376,8 +391,18 @@ void LoadISISNexus2::exec() {
       // lo
       prepareSpectraBlocks(m_monitors, m_monBlockInfo);
 
+      const bool loadAllMonitorPeriods =
+          m_detBlockInfo.getNumberOfPeriods() > 1 && m_entrynumber == 0;
+      std::vector<DataObjects::Workspace2D_sptr> monitorWorkspaces{
+          monitor_workspace};
+      if (loadAllMonitorPeriods) {
+        for (int p = 2; p <= m_detBlockInfo.getNumberOfPeriods(); ++p)
+          monitorWorkspaces.emplace_back(
+              boost::dynamic_pointer_cast<DataObjects::Workspace2D>(
+                  WorkspaceFactory::Instance().create(period_free_workspace)));
+      }
       firstentry = (m_entrynumber > 0) ? m_entrynumber : 1;
-      loadPeriodData(firstentry, entry, monitor_workspace, true);
+      loadPeriodData(firstentry, entry, monitorWorkspaces, true);
       local_workspace->setMonitorWorkspace(monitor_workspace);
 
       ISISRunLogs monLogCreator(monitor_workspace->run());
@@ -385,7 +410,7 @@ void LoadISISNexus2::exec() {
 
       const std::string monitorPropBase = "MonitorWorkspace";
       const std::string monitorWsNameBase = wsName + "_monitors";
-      if (m_detBlockInfo.getNumberOfPeriods() > 1 && m_entrynumber == 0) {
+      if (loadAllMonitorPeriods) {
         WorkspaceGroup_sptr monitor_group(new WorkspaceGroup);
         monitor_group->setTitle(monitor_workspace->getTitle());
 
@@ -394,11 +419,7 @@ void LoadISISNexus2::exec() {
           os << "_" << p;
           m_progress->report("Loading period " + os.str());
           if (p > 1) {
-            monitor_workspace =
-                boost::dynamic_pointer_cast<DataObjects::Workspace2D>(
-                    WorkspaceFactory::Instance().create(period_free_workspace));
-            loadPeriodData(p, entry, monitor_workspace,
-                           m_load_selected_spectra);
+            monitor_workspace = monitorWorkspaces[p - 1];
             monLogCreator.addPeriodLogs(p, monitor_workspace->mutableRun());
             // Check consistency of logs data for multi-period workspaces and
             // raise
@@ -784,42 +805,51 @@ void LoadISISNexus2::checkOverlappingSpectraRange() {
 }
 
 /**
- * Load a given period into the workspace
- * @param period :: The period number to load (starting from 1)
+ * Load the data of a run of consecutive periods into a workspace per period.
+ * Each block of the file is read once for all of the periods.
+ * @param period :: The first period number to load (starting from 1)
  * @param entry :: The opened root entry node for accessing the monitor and data
  * nodes
- * @param local_workspace :: The workspace to place the data in
+ * @param periodWorkspaces :: The workspaces to place the data in, one for each
+ * period starting from period
  * @param update_spectra2det_mapping :: reset spectra-detector map to the one
  * calculated earlier. (Warning! -- this map has to be calculated correctly!)
  */
 void LoadISISNexus2::loadPeriodData(
     int64_t period, NXEntry &entry,
-    DataObjects::Workspace2D_sptr &local_workspace,
+    const std::vector<DataObjects::Workspace2D_sptr> &periodWorkspaces,
     bool update_spectra2det_mapping) {
   int64_t hist_index = 0;
   int64_t period_index(period - 1);
-  // int64_t first_monitor_spectrum = 0;
+  const auto nperiods = static_cast<int64_t>(periodWorkspaces.size());
 
   for (auto &spectraBlock : m_spectraBlocks) {
     if (spectraBlock.isMonitor) {
       NXData monitor = entry.openNXData(spectraBlock.monName);
       NXInt mondata = monitor.openIntData();
-      m_progress->report("Loading monitor");
-      mondata.load(1, static_cast<int>(period - 1)); // TODO this is just wrong
+      m_progress->reportIncrement(static_cast<size_t>(nperiods),
+                                  "Loading monitor");
+      // The monitor counts of all periods are small enough to read at once
+      mondata.load();
+      const int64_t period_stride =
+          mondata.rank() > 1 ? mondata.size() / mondata.dim0() : 0;
       NXFloat timeBins = monitor.openNXFloat("time_of_flight");
       timeBins.load();
-      local_workspace->setHistogram(
-          hist_index, BinEdges(timeBins(), timeBins() + timeBins.dim0()),
-          Counts(mondata(), mondata() + m_monBlockInfo.getNumberOfChannels()));
-
-      if (update_spectra2det_mapping) {
-        // local_workspace->getAxis(1)->setValue(hist_index,
-        // static_cast<specnum_t>(it->first));
-        auto &spec = local_workspace->getSpectrum(hist_index);
-        specnum_t specNum = m_wsInd2specNum_map.at(hist_index);
-        spec.setDetectorIDs(
-            m_spec2det_map.getDetectorIDsForSpectrumNo(specNum));
-        spec.setSpectrumNo(specNum);
+      const BinEdges binEdges(timeBins(), timeBins() + timeBins.dim0());
+      for (int64_t p = 0; p < nperiods; ++p) {
+        const int *counts = mondata() + (period_index + p) * period_stride;
+        auto &local_workspace = periodWorkspaces[p];
+        local_workspace->setHistogram(
+            hist_index, binEdges,
+            Counts(counts, counts + m_monBlockInfo.getNumberOfChannels()));
+
+        if (update_spectra2det_mapping) {
+          auto &spec = local_workspace->getSpectrum(hist_index);
+          specnum_t specNum = m_wsInd2specNum_map.at(hist_index);
+          spec.setDetectorIDs(
+              m_spec2det_map.getDetectorIDsForSpectrumNo(specNum));
+          spec.setSpectrumNo(specNum);
+        }
       }
       hist_index++;
     } else if (m_have_detector) {
@@ -828,10 +858,16 @@ void LoadISISNexus2::loadPeriodData(
       data.open();
       // Start with the list members that are lower than the required spectrum
       const int *const spec_begin = m_spec.get();
-      // When reading in blocks we need to be careful that the range is exactly
-      // divisible by the block-size
-      // and if not have an extra read of the left overs
-      const int64_t blocksize = 8;
+      // Read as many spectra at a time as fit in a slab of SLAB_BYTES for all
+      // of the periods. When reading in blocks we need to be careful that the
+      // range is exactly divisible by the block-size and if not have an extra
+      // read of the left overs
+      const auto spectrum_bytes = std::max(
+          nperiods * static_cast<int64_t>(sizeof(int) *
+                                          m_detBlockInfo.getNumberOfChannels()),
+          int64_t(1));
+      const int64_t blocksize =
+          std::max(MIN_BLOCK_SIZE, SLAB_BYTES / spectrum_bytes);
       const int64_t rangesize = spectraBlock.last - spectraBlock.first + 1;
       const int64_t fullblocks = rangesize / blocksize;
       int64_t spectra_no = spectraBlock.first;
@@ -843,23 +879,25 @@ void LoadISISNexus2::loadPeriodData(
       if (fullblocks > 0) {
         for (int64_t i = 0; i < fullblocks; ++i) {
           loadBlock(data, blocksize, period_index, filestart, hist_index,
-                    spectra_no, local_workspace);
+                    spectra_no, periodWorkspaces);
           filestart += blocksize;
         }
       }
       int64_t finalblock = rangesize - (fullblocks * blocksize);
       if (finalblock > 0) {
         loadBlock(data, finalblock, period_index, filestart, hist_index,
-                  spectra_no, local_workspace);
+                  spectra_no, periodWorkspaces);
       }
     }
   }
 
   try {
     const std::string title = entry.getString("title");
-    local_workspace->setTitle(title);
-    // write the title into the log file (run object)
-    local_workspace->mutableRun().addProperty("run_title", title, true);
+    for (const auto &local_workspace : periodWorkspaces) {
+      local_workspace->setTitle(title);
+      // write the title into the log file (run object)
+      local_workspace->mutableRun().addProperty("run_title", title, true);
+    }
   } catch (std::runtime_error &) {
     g_log.debug() << "No title was found in the input file, "
                   << getPropertyValue("Filename") << '\n';
@@ -878,45 +916,49 @@ void LoadISISNexus2::createPeriodLogs(
 }
 
 /**
- * Perform a call to nxgetslab, via the NexusClasses wrapped methods for a given
- * block-size
+ * Perform a call to nxgetslab, via the NexusClasses wrapped methods, reading
+ * a block of spectra for all of the periods at once and then filling the
+ * period workspaces in parallel
  * @param data :: The NXDataSet object
  * @param blocksize :: The block-size to use
- * @param period :: The period number
+ * @param period :: The index of the first period to read (zero based)
  * @param start :: The index within the file to start reading from (zero based)
  * @param hist :: The workspace index to start reading into
  * @param spec_num :: The spectrum number that matches the hist variable
- * @param local_workspace :: The workspace to fill the data with
+ * @param periodWorkspaces :: The workspaces to fill, one for each period
  */
-void LoadISISNexus2::loadBlock(NXDataSetTyped<int> &data, int64_t blocksize,
-                               int64_t period, int64_t start, int64_t &hist,
-                               int64_t &spec_num,
-                               DataObjects::Workspace2D_sptr &local_workspace) {
-  data.load(static_cast<int>(blocksize), static_cast<int>(period),
-            static_cast<int>(start)); // TODO this is just wrong
-  int *data_start = data();
-  int *data_end = data_start + m_loadBlockInfo.getNumberOfChannels();
-  int64_t final(hist + blocksize);
-  while (hist < final) {
-    m_progress->report("Loading data");
-    local_workspace->setHistogram(hist, BinEdges(m_tof_data),
-                                  Counts(data_start, data_end));
-    data_start += m_detBlockInfo.getNumberOfChannels();
-    data_end += m_detBlockInfo.getNumberOfChannels();
+void LoadISISNexus2::loadBlock(
+    NXDataSetTyped<int> &data, int64_t blocksize, int64_t period,
+    int64_t start, int64_t &hist, int64_t &spec_num,
+    const std::vector<DataObjects::Workspace2D_sptr> &periodWorkspaces) {
+  const auto nperiods = static_cast<int64_t>(periodWorkspaces.size());
+  data.loadBlock(static_cast<int>(blocksize), static_cast<int>(period),
+                 static_cast<int>(nperiods), static_cast<int>(start));
+  const int *const buffer = data();
+  const int64_t stride = m_detBlockInfo.getNumberOfChannels();
+  const int64_t nchannels = m_loadBlockInfo.getNumberOfChannels();
+  const int64_t first_hist = hist;
+  const int64_t nitems = nperiods * blocksize;
+  // The slab is laid out as [period][spectrum][channel]
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t item = 0; item < nitems; ++item) {
+    auto &local_workspace = *periodWorkspaces[item / blocksize];
+    const int64_t wsIndex = first_hist + item % blocksize;
+    const int *data_start = buffer + item * stride;
+    local_workspace.setHistogram(wsIndex, BinEdges(m_tof_data),
+                                 Counts(data_start, data_start + nchannels));
     if (m_load_selected_spectra) {
-      // local_workspace->getAxis(1)->setValue(hist,
-      // static_cast<specnum_t>(spec_num));
-      auto &spec = local_workspace->getSpectrum(hist);
-      specnum_t specNum = m_wsInd2specNum_map.at(hist);
+      auto &spec = local_workspace.getSpectrum(wsIndex);
+      specnum_t specNum = m_wsInd2specNum_map.at(wsIndex);
       // set detectors corresponding to spectra Number
       spec.setDetectorIDs(m_spec2det_map.getDetectorIDsForSpectrumNo(specNum));
       // set correct spectra Number
       spec.setSpectrumNo(specNum);
     }
-
-    ++hist;
-    ++spec_num;
   }
+  m_progress->reportIncrement(static_cast<size_t>(nitems), "Loading data");
+  hist += blocksize;
+  spec_num += blocksize;
 }
 
 /// Run the Child Algorithm LoadInstrument (or LoadInstrumentFromNexus)
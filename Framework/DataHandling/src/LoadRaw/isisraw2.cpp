@@ -167,6 +167,44 @@ bool ISISRAW2::readData(FILE *file, int i) {
   return true;
 }
 
+/// Size of the compressed data of a spectrum
+/// @param i :: The index of the spectrum descriptor
+/// @return The size in bytes, 0 if there is no such descriptor
+int ISISRAW2::compressedSize(int i) const {
+  return i < ndes ? 4 * ddes[i].nwords : 0;
+}
+
+/// Read the compressed data of consecutive spectra with a single read. The
+/// file must be positioned at the start of the data of the first spectrum.
+/// @param file :: The file pointer
+/// @param first :: The index of the first spectrum descriptor to read
+/// @param last :: The index one past the last spectrum descriptor to read
+/// @param buffer :: Receives the compressed data of the spectra in order
+/// @return true on success
+bool ISISRAW2::readCompressedData(FILE *file, int first, int last,
+                                  std::vector<char> &buffer) {
+  if (first < 0 || last > ndes || first >= last)
+    return false;
+  size_t nbytes = 0;
+  for (int i = first; i < last; ++i)
+    nbytes += compressedSize(i);
+  buffer.resize(nbytes);
+  if (nbytes == 0)
+    return true;
+  return fread(buffer.data(), sizeof(char), nbytes, file) == nbytes;
+}
+
+/// Expand the compressed data of a spectrum read by readCompressedData. This
+/// does not use any buffer of the reader, so spectra can be expanded
+/// concurrently.
+/// @param compressed :: The start of the compressed data of the spectrum
+/// @param i :: The index of the spectrum descriptor
+/// @param out :: Receives the t_ntc1 + 1 counts of the spectrum
+void ISISRAW2::expandData(char *compressed, int i, uint32_t *out) const {
+  byte_rel_expn(compressed, compressedSize(i), 0, reinterpret_cast<int *>(out),
+                t_ntc1 + 1);
+}
+
 ISISRAW2::~ISISRAW2() {
   if (outbuff)
     delete[] outbuff;
@@ -8,6 +8,8 @@
 
 #include "isisraw.h"
 
+#include <vector>
+
 /// isis raw file.
 //  isis raw
 class ISISRAW2 : public ISISRAW {
@@ -19,6 +21,10 @@ public:
 
   void skipData(FILE *file, int i);
   bool readData(FILE *file, int i);
+  int compressedSize(int i) const;
+  bool readCompressedData(FILE *file, int first, int last,
+                          std::vector<char> &buffer);
+  void expandData(char *compressed, int i, uint32_t *out) const;
   void clear();
 
   int ndes; ///< ndes
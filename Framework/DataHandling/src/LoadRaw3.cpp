@@ -17,6 +17,7 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/UnitFactory.h"
 
 #include <Poco/Path.h>
@@ -31,6 +32,12 @@ DECLARE_FILELOADER_ALGORITHM(LoadRaw3)
 using namespace Kernel;
 using namespace API;
 
+namespace {
+/// The largest amount of compressed data read from the file at once, unless a
+/// single spectrum is larger
+constexpr size_t MAX_CHUNK_BYTES = 32 * 1024 * 1024;
+} // namespace
+
 /// Constructor
 LoadRaw3::LoadRaw3()
     : m_filename(), m_numberOfSpectra(), m_cache_options(), m_specTimeRegimes(),
@@ -312,44 +319,14 @@ void LoadRaw3::exec() {
 void LoadRaw3::excludeMonitors(FILE *file, const int &period,
                                const std::vector<specnum_t> &monitorList,
                                DataObjects::Workspace2D_sptr ws_sptr) {
-  int64_t histCurrent = -1;
+  std::vector<SpectrumTarget> targets;
   int64_t wsIndex = 0;
-  auto histTotal = static_cast<double>(m_total_specs * m_numberOfPeriods);
-  // loop through the spectra
   for (specnum_t i = 1; i <= m_numberOfSpectra; ++i) {
-    specnum_t histToRead = i + period * (m_numberOfSpectra + 1);
-    if ((i >= m_spec_min && i < m_spec_max) ||
-        (m_list && find(m_spec_list.begin(), m_spec_list.end(), i) !=
-                       m_spec_list.end())) {
-      progress(m_prog, "Reading raw file data...");
-      // skip monitor spectrum
-      if (isMonitor(monitorList, i)) {
-        skipData(file, histToRead);
-        continue;
-      }
-
-      // read spectrum
-      if (!readData(file, histToRead)) {
-        throw std::runtime_error("Error reading raw file");
-      }
-      // set the workspace data
-      setWorkspaceData(ws_sptr, m_timeChannelsVec, wsIndex, i, m_noTimeRegimes,
-                       m_lengthIn, 1);
-      // increment workspace index
-      ++wsIndex;
-
-      if (m_numberOfPeriods == 1) {
-        if (++histCurrent % 100 == 0) {
-          setProg(static_cast<double>(histCurrent) / histTotal);
-        }
-        interruption_point();
-      }
-
-    } // end of if loop for spec min,max check
-    else {
-      skipData(file, histToRead);
-    }
-  } // end of for loop
+    // skip monitor spectrum
+    if (isSpectrumSelected(i) && !isMonitor(monitorList, i))
+      targets.push_back({i, ws_sptr, wsIndex++});
+  }
+  readSpectra(file, period, targets);
 }
 
 /**This method creates outputworkspace including monitors
@@ -359,39 +336,13 @@ void LoadRaw3::excludeMonitors(FILE *file, const int &period,
  */
 void LoadRaw3::includeMonitors(FILE *file, const int64_t &period,
                                DataObjects::Workspace2D_sptr ws_sptr) {
-
-  int64_t histCurrent = -1;
+  std::vector<SpectrumTarget> targets;
   int64_t wsIndex = 0;
-  auto histTotal = static_cast<double>(m_total_specs * m_numberOfPeriods);
-  // loop through spectra
   for (specnum_t i = 1; i <= m_numberOfSpectra; ++i) {
-    int64_t histToRead = i + period * (m_numberOfSpectra + 1);
-    if ((i >= m_spec_min && i < m_spec_max) ||
-        (m_list && find(m_spec_list.begin(), m_spec_list.end(), i) !=
-                       m_spec_list.end())) {
-      progress(m_prog, "Reading raw file data...");
-
-      // read spectrum from raw file
-      if (!readData(file, histToRead)) {
-        throw std::runtime_error("Error reading raw file");
-      }
-      // set workspace data
-      setWorkspaceData(ws_sptr, m_timeChannelsVec, wsIndex, i, m_noTimeRegimes,
-                       m_lengthIn, 1);
-      ++wsIndex;
-
-      if (m_numberOfPeriods == 1) {
-        if (++histCurrent % 100 == 0) {
-          setProg(double(histCurrent) / histTotal);
-        }
-        interruption_point();
-      }
-
-    } else {
-      skipData(file, histToRead);
-    }
+    if (isSpectrumSelected(i))
+      targets.push_back({i, ws_sptr, wsIndex++});
   }
-  // loadSpectra(file,period,m_total_specs,ws_sptr,m_timeChannelsVec);
+  readSpectra(file, period, targets);
 }
 
 /** This method separates monitors and creates two outputworkspaces
@@ -406,45 +357,95 @@ void LoadRaw3::separateMonitors(FILE *file, const int64_t &period,
                                 const std::vector<specnum_t> &monitorList,
                                 DataObjects::Workspace2D_sptr ws_sptr,
                                 DataObjects::Workspace2D_sptr mws_sptr) {
-  int64_t histCurrent = -1;
+  std::vector<SpectrumTarget> targets;
   int64_t wsIndex = 0;
   int64_t mwsIndex = 0;
-  auto histTotal = static_cast<double>(m_total_specs * m_numberOfPeriods);
-  // loop through spectra
   for (specnum_t i = 1; i <= m_numberOfSpectra; ++i) {
-    int64_t histToRead = i + period * (m_numberOfSpectra + 1);
-    if ((i >= m_spec_min && i < m_spec_max) ||
-        (m_list && find(m_spec_list.begin(), m_spec_list.end(), i) !=
-                       m_spec_list.end())) {
-      progress(m_prog, "Reading raw file data...");
-
-      // read spectrum from raw file
-      if (!readData(file, histToRead)) {
-        throw std::runtime_error("Error reading raw file");
-      }
-      // if this a monitor  store that spectrum to monitor workspace
-      if (isMonitor(monitorList, i)) {
-        setWorkspaceData(mws_sptr, m_timeChannelsVec, mwsIndex, i,
-                         m_noTimeRegimes, m_lengthIn, 1);
-        ++mwsIndex;
-      } else {
-        // not a monitor,store the spectrum to normal output workspace
-        setWorkspaceData(ws_sptr, m_timeChannelsVec, wsIndex, i,
-                         m_noTimeRegimes, m_lengthIn, 1);
-        ++wsIndex;
-      }
+    if (!isSpectrumSelected(i))
+      continue;
+    // if this a monitor  store that spectrum to monitor workspace
+    if (isMonitor(monitorList, i))
+      targets.push_back({i, mws_sptr, mwsIndex++});
+    else
+      targets.push_back({i, ws_sptr, wsIndex++});
+  }
+  readSpectra(file, period, targets);
+}
 
-      if (m_numberOfPeriods == 1) {
-        if (++histCurrent % 100 == 0) {
-          setProg(static_cast<double>(histCurrent) / histTotal);
-        }
-        interruption_point();
-      }
+/** Read the spectra of a period into their workspaces. Runs of consecutive
+ * spectra are read from the file in large chunks, and the spectra of a chunk
+ * are decompressed in parallel straight into the workspaces. The file must be
+ * positioned after spectrum 0 of the period and is left at the end of the
+ * period.
+ * @param file :: -pointer to file
+ * @param period :: period number
+ * @param targets :: the spectra to read, in increasing spectrum number order
+ */
+void LoadRaw3::readSpectra(FILE *file, const int64_t period,
+                           const std::vector<SpectrumTarget> &targets) {
+  auto &raw = isisRaw();
+  const int64_t firstHist = period * (m_numberOfSpectra + 1);
+  auto histTotal = static_cast<double>(m_total_specs * m_numberOfPeriods);
+  std::vector<char> buffer;
+  std::vector<size_t> offsets;
+  specnum_t next = 1;
+  size_t begin = 0;
+  while (begin < targets.size()) {
+    progress(m_prog, "Reading raw file data...");
+    for (; next < targets[begin].spectrum; ++next)
+      skipData(file, firstHist + next);
+
+    // Gather consecutive spectra up to the chunk size
+    const auto first = static_cast<int>(firstHist + targets[begin].spectrum);
+    int last = first;
+    size_t end = begin;
+    offsets.assign(1, 0);
+    do {
+      offsets.emplace_back(offsets.back() + raw.compressedSize(last++));
+      ++end;
+    } while (end < targets.size() &&
+             targets[end].spectrum == targets[end - 1].spectrum + 1 &&
+             offsets.back() + raw.compressedSize(last) <= MAX_CHUNK_BYTES);
+
+    if (!raw.readCompressedData(file, first, last, buffer)) {
+      throw std::runtime_error("Error reading raw file");
+    }
 
-    } else {
-      skipData(file, histToRead);
+    const auto numInChunk = static_cast<int64_t>(end - begin);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t k = 0; k < numInChunk; ++k) {
+      PARALLEL_START_INTERUPT_REGION
+      const auto &target = targets[begin + static_cast<size_t>(k)];
+      std::vector<uint32_t> counts(raw.t_ntc1 + 1);
+      raw.expandData(buffer.data() + offsets[k], first + static_cast<int>(k),
+                     counts.data());
+      setWorkspaceData(target.workspace, m_timeChannelsVec, target.wsIndex,
+                       target.spectrum, m_noTimeRegimes, m_lengthIn, 1,
+                       counts.data());
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+
+    next = targets[end - 1].spectrum + 1;
+    begin = end;
+    if (m_numberOfPeriods == 1) {
+      setProg(static_cast<double>(begin) / histTotal);
+      interruption_point();
     }
   }
+  // Move to the end of the period
+  for (; next <= m_numberOfSpectra; ++next)
+    skipData(file, firstHist + next);
+}
+
+/** Check if a spectrum was selected by the SpectrumMin, SpectrumMax and
+ * SpectrumList properties.
+ * @param spectrum :: The spectrum number
+ */
+bool LoadRaw3::isSpectrumSelected(specnum_t spectrum) const {
+  return (spectrum >= m_spec_min && spectrum < m_spec_max) ||
+         (m_list && std::find(m_spec_list.begin(), m_spec_list.end(),
+                              spectrum) != m_spec_list.end());
 }
 
 /**
@@ -7,8 +7,11 @@
 #include "MantidDataHandling/ParallelEventLoader.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidIndexing/GlobalSpectrumIndex.h"
 #include "MantidIndexing/IndexInfo.h"
+#include "MantidParallel/Communicator.h"
 #include "MantidParallel/IO/EventLoader.h"
+#include "MantidParallel/IO/SpectrumPartitioning.h"
 #include "MantidTypes/Event/TofEvent.h"
 #include "MantidTypes/SpectrumDefinition.h"
 
@@ -102,6 +105,24 @@ std::vector<int32_t> getOffsets(const DataObjects::EventWorkspace &ws,
   return offsets;
 }
 
+/// Return the partition and local index of every global spectrum index, such
+/// that events are sent to the rank holding their spectrum in `indexInfo`.
+std::shared_ptr<const Parallel::IO::SpectrumPartitioning>
+makeSpectrumPartitioning(const Indexing::IndexInfo &indexInfo) {
+  auto partitioning = std::make_shared<Parallel::IO::SpectrumPartitioning>();
+  const auto globalSize = indexInfo.globalSize();
+  partitioning->partition.reserve(globalSize);
+  partitioning->localIndex.reserve(globalSize);
+  std::vector<int32_t> localSize(indexInfo.communicator().size(), 0);
+  for (size_t i = 0; i < globalSize; ++i) {
+    const auto partition = static_cast<int>(
+        indexInfo.partitionOf(Indexing::GlobalSpectrumIndex(i)));
+    partitioning->partition.emplace_back(partition);
+    partitioning->localIndex.emplace_back(localSize[partition]++);
+  }
+  return partitioning;
+}
+
 /// Load events from given banks into given EventWorkspace using MPI.
 void ParallelEventLoader::loadMPI(DataObjects::EventWorkspace &ws,
                                   const std::string &filename,
@@ -112,9 +133,9 @@ void ParallelEventLoader::loadMPI(DataObjects::EventWorkspace &ws,
       getResultVector(ws);
   std::vector<int32_t> offsets =
       getOffsets(ws, filename, groupName, bankNames, eventIDIsSpectrumNumber);
-  Parallel::IO::EventLoader::load(ws.indexInfo().communicator(), filename,
-                                  groupName, bankNames, offsets,
-                                  std::move(eventLists));
+  Parallel::IO::EventLoader::load(
+      ws.indexInfo().communicator(), filename, groupName, bankNames, offsets,
+      std::move(eventLists), makeSpectrumPartitioning(ws.indexInfo()));
 }
 
 /// Load events from given banks into given EventWorkspace using
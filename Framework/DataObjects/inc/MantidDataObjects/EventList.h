@@ -89,6 +89,8 @@ public:
 
   EventList &operator+=(const EventList &more_events);
 
+  EventList &accumulate(const EventList &more_events);
+
   EventList &operator-=(const EventList &more_events);
 
   bool operator==(const EventList &rhs) const;
@@ -412,14 +414,20 @@ private:
 
   void switchToWeightedEvents();
   void switchToWeightedEventsNoTime();
+  void reserveAndSwitchTo(Mantid::API::EventType newType, size_t numEvents,
+                          bool growGeometrically = false);
+  EventList &addEventList(const EventList &more_events, bool growGeometrically);
   // should not be called externally
   void sortPulseTimeTOFDelta(const Types::Core::DateAndTime &start,
                              const double seconds) const;
 
   // helper functions are all internal to simplify the code
   template <class T1, class T2>
+  static void plusHelper(std::vector<T1> &events,
+                         const std::vector<T2> &more_events, const bool merge);
+  template <class T1, class T2>
   static void minusHelper(std::vector<T1> &events,
-                          const std::vector<T2> &more_events);
+                          const std::vector<T2> &more_events, const bool merge);
   template <class T>
   static void compressEventsHelper(const std::vector<T> &events,
                                    std::vector<WeightedEventNoTime> &out,
@@ -33,6 +33,37 @@ namespace DataObjects {
 
 namespace FractionalRebinning {
 
+/**
+ * Accumulates the signal, variance and fractions of a fractional rebin away
+ * from the output workspace. Several buffers can be filled concurrently
+ * without locking and then added to the output in a fixed order.
+ */
+class MANTID_DATAOBJECTS_DLL FractionalRebinningBuffer {
+public:
+  FractionalRebinningBuffer(const size_t numberHistograms,
+                            const size_t numberBins);
+  /// Add a contribution to an output bin
+  void add(const size_t wsIndex, const size_t binIndex, const double signal,
+           const double variance, const double fraction) {
+    const size_t index = wsIndex * m_numberBins + binIndex;
+    m_signal[index] += signal;
+    m_variance[index] += variance;
+    m_fraction[index] += fraction;
+  }
+  /// Add the buffer to the output workspace
+  void addTo(DataObjects::RebinnedOutput &outputWS) const;
+  /// Number of buffers of the given size that fit in the memory budget
+  static size_t maxNumberOfBuffers(const size_t numberHistograms,
+                                   const size_t numberBins,
+                                   const size_t maxBuffers);
+
+private:
+  size_t m_numberBins;
+  std::vector<double> m_signal;
+  std::vector<double> m_variance;
+  std::vector<double> m_fraction;
+};
+
 /// Find the intersect region on the output grid
 MANTID_DATAOBJECTS_DLL bool
 getIntersectionRegion(const std::vector<double> &xAxis,
@@ -61,6 +92,14 @@ MANTID_DATAOBJECTS_DLL void rebinToFractionalOutput(
     const std::vector<double> &verticalAxis,
     const DataObjects::RebinnedOutput_const_sptr &inputRB = nullptr);
 
+/// Rebin the input quadrilateral to a buffer for the output grid
+MANTID_DATAOBJECTS_DLL void rebinToFractionalOutput(
+    const Geometry::Quadrilateral &inputQ,
+    const API::MatrixWorkspace_const_sptr &inputWS, const size_t i,
+    const size_t j, const DataObjects::RebinnedOutput &outputWS,
+    const std::vector<double> &verticalAxis, FractionalRebinningBuffer &buffer,
+    const DataObjects::RebinnedOutput_const_sptr &inputRB = nullptr);
+
 /// Set finalize flag after fractional rebinning loop
 MANTID_DATAOBJECTS_DLL void
 finalizeFractionalRebin(DataObjects::RebinnedOutput &outputWS);
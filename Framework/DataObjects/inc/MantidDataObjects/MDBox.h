@@ -212,6 +212,12 @@ public:
   void getBoxes(std::vector<API::IMDNode *> &outBoxes,
                 const std::function<bool(API::IMDNode *)> &cond) final override;
   //------------------------------------------------------------------------------------------------------------------------------------
+  void sortEventsByMortonIndex();
+  /// @return true if the events are stored in the order of their Morton index
+  bool isSortedByMortonIndex() const { return m_sortedByMortonIndex; }
+  std::pair<size_t, size_t> getEventRangeInBounds(const coord_t *min,
+                                                  const coord_t *max) const;
+  //------------------------------------------------------------------------------------------------------------------------------------
   void transformDimensions(std::vector<double> &scaling,
                            std::vector<double> &offset) override;
   //------------------------------------------------------------------------------------------------------------------------------------
@@ -233,7 +239,17 @@ protected:
   /// Flag indicating that masking has been applied.
   bool m_bIsMasked;
 
+  /// Flag indicating that the events are sorted by their Morton index within
+  /// the box. Reset by any non-const access to the events.
+  bool m_sortedByMortonIndex;
+
 private:
+  using MortonCoordinates = morton_index::IntArray<nd, typename MDE::IntT>;
+  morton_index::MDSpaceBounds<nd> getMortonSpace() const;
+  static MortonCoordinates
+  toMortonCoordinates(const coord_t *center,
+                      const morton_index::MDSpaceBounds<nd> &space);
+
   /// private default copy constructor as the only correct constructor is the
   /// one with the boxController;
   MDBox(const MDBox &);
@@ -44,7 +44,7 @@ TMDE(MDBox)::~MDBox() {
 TMDE(MDBox)::MDBox(API::BoxController_sptr &splitter, const uint32_t depth,
                    const size_t nBoxEvents, const size_t boxID)
     : MDBoxBase<MDE, nd>(splitter.get(), depth, boxID), m_Saveable(nullptr),
-      m_bIsMasked(false) {
+      m_bIsMasked(false), m_sortedByMortonIndex(false) {
   initMDBox(nBoxEvents);
 }
 
@@ -58,7 +58,7 @@ TMDE(MDBox)::MDBox(API::BoxController_sptr &splitter, const uint32_t depth,
 TMDE(MDBox)::MDBox(API::BoxController *const splitter, const uint32_t depth,
                    const size_t nBoxEvents, const size_t boxID)
     : MDBoxBase<MDE, nd>(splitter, depth, boxID), m_Saveable(nullptr),
-      m_bIsMasked(false) {
+      m_bIsMasked(false), m_sortedByMortonIndex(false) {
   initMDBox(nBoxEvents);
 }
 
@@ -77,7 +77,7 @@ TMDE(MDBox)::MDBox(
         &extentsVector,
     const size_t nBoxEvents, const size_t boxID)
     : MDBoxBase<MDE, nd>(splitter.get(), depth, boxID, extentsVector),
-      m_Saveable(nullptr), m_bIsMasked(false) {
+      m_Saveable(nullptr), m_bIsMasked(false), m_sortedByMortonIndex(false) {
   initMDBox(nBoxEvents);
 }
 //-----------------------------------------------------------------------------------------------
@@ -95,7 +95,7 @@ TMDE(MDBox)::MDBox(
         &extentsVector,
     const size_t nBoxEvents, const size_t boxID)
     : MDBoxBase<MDE, nd>(splitter, depth, boxID, extentsVector),
-      m_Saveable(nullptr), m_bIsMasked(false) {
+      m_Saveable(nullptr), m_bIsMasked(false), m_sortedByMortonIndex(false) {
   initMDBox(nBoxEvents);
 }
 
@@ -115,7 +115,7 @@ MDBox<MDE, nd>::MDBox(
         &extentsVector,
     EventIterator begin, EventIterator end)
     : MDBoxBase<MDE, nd>(bc, depth, 0, extentsVector), m_Saveable(nullptr),
-      m_bIsMasked(false) {
+      m_bIsMasked(false), m_sortedByMortonIndex(false) {
   data = std::vector<MDE>(begin, end);
   MDBoxBase<MDE, nd>::calcCaches(data.begin(), data.end());
   if (this->m_BoxController->isFileBacked())
@@ -144,7 +144,8 @@ TMDE(void MDBox)::initMDBox(const size_t nBoxEvents) {
 TMDE(MDBox)::MDBox(const MDBox<MDE, nd> &other,
                    Mantid::API::BoxController *const otherBC)
     : MDBoxBase<MDE, nd>(other, otherBC), m_Saveable(nullptr), data(other.data),
-      m_bIsMasked(other.m_bIsMasked) {
+      m_bIsMasked(other.m_bIsMasked),
+      m_sortedByMortonIndex(other.m_sortedByMortonIndex) {
   if (otherBC) // may be absent in some tests but generally have to be present
   {
     if (otherBC->isFileBacked())
@@ -263,6 +264,8 @@ TMDE(uint64_t MDBox)::getNPoints() const {
  * data.
  */
 TMDE(std::vector<MDE> &MDBox)::getEvents() {
+  // the caller may reorder or move the events
+  m_sortedByMortonIndex = false;
   if (!m_Saveable)
     return data;
   else {
@@ -349,6 +352,7 @@ TMDE(void MDBox)::getEventsData(std::vector<coord_t> &coordTable,
  */
 TMDE(void MDBox)::setEventsData(const std::vector<coord_t> &coordTable) {
   MDE::dataToEvents(coordTable, this->data);
+  m_sortedByMortonIndex = false;
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -758,6 +762,116 @@ TMDE(void MDBox)::transformDimensions(std::vector<double> &scaling,
     m_Saveable->setBusy(false);
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Sort the events in this box by the Morton (Z-order) of their centres, taken
+ * within the extents of the box. Events lying inside any axis-aligned region
+ * of the box then form a contiguous range of the event vector, which can be
+ * found with getEventRangeInBounds().
+ *
+ * The order is kept until the events are next accessed for modification.
+ */
+TMDE(void MDBox)::sortEventsByMortonIndex() {
+  std::vector<MDE> &events = this->getEvents();
+  const auto space = getMortonSpace();
+
+  std::vector<std::pair<MortonCoordinates, size_t>> indexes;
+  indexes.reserve(events.size());
+  for (size_t i = 0; i < events.size(); ++i)
+    indexes.emplace_back(toMortonCoordinates(events[i].getCenter(), space), i);
+
+  // Boxes built from Morton-sorted events are usually in order already
+  const auto byIndex = [](const std::pair<MortonCoordinates, size_t> &a,
+                          const std::pair<MortonCoordinates, size_t> &b) {
+    return morton_index::morton_less<nd>(a.first, b.first);
+  };
+  if (!std::is_sorted(indexes.cbegin(), indexes.cend(), byIndex)) {
+    std::stable_sort(indexes.begin(), indexes.end(), byIndex);
+    std::vector<MDE> sorted;
+    sorted.reserve(events.size());
+    for (const auto &index : indexes)
+      sorted.emplace_back(events[index.second]);
+    events.swap(sorted);
+  }
+  this->releaseEvents();
+  m_sortedByMortonIndex = true;
+}
+
+//-----------------------------------------------------------------------------------------------
+/** Find the range of events that may lie within an axis-aligned region.
+ *
+ * If the box is sorted by Morton index (see sortEventsByMortonIndex()) every
+ * event inside the region is within the returned range, so only that part of
+ * the event vector needs to be scanned. The range can still contain events
+ * outside of the region, which the caller must reject. If the box is not
+ * sorted the range covers all events. The events must be in memory, i.e.
+ * this is called after getConstEvents().
+ *
+ * @param min :: nd-sized array with the lower bounds of the region
+ * @param max :: nd-sized array with the upper bounds of the region
+ * @return the [first, last) indexes of the range in the event vector
+ */
+template <typename MDE, size_t nd>
+std::pair<size_t, size_t>
+MDBox<MDE, nd>::getEventRangeInBounds(const coord_t *min,
+                                      const coord_t *max) const {
+  if (!m_sortedByMortonIndex)
+    return {0, data.size()};
+
+  const auto space = getMortonSpace();
+  coord_t lower[nd];
+  coord_t upper[nd];
+  for (size_t d = 0; d < nd; ++d) {
+    lower[d] = std::max(min[d], static_cast<coord_t>(space(d, 0)));
+    upper[d] = std::min(max[d], static_cast<coord_t>(space(d, 1)));
+    if (lower[d] > upper[d])
+      return {0, 0};
+  }
+
+  // The Morton order is monotonic in every coordinate so the points inside
+  // the region lie between its lowest and highest corners along the curve
+  const auto lowerCorner = toMortonCoordinates(lower, space);
+  const auto upperCorner = toMortonCoordinates(upper, space);
+  const auto first = std::lower_bound(
+      data.cbegin(), data.cend(), lowerCorner,
+      [&space](const MDE &event, const MortonCoordinates &corner) {
+        return morton_index::morton_less<nd>(
+            toMortonCoordinates(event.getCenter(), space), corner);
+      });
+  const auto last = std::upper_bound(
+      first, data.cend(), upperCorner,
+      [&space](const MortonCoordinates &corner, const MDE &event) {
+        return morton_index::morton_less<nd>(
+            corner, toMortonCoordinates(event.getCenter(), space));
+      });
+  return {static_cast<size_t>(std::distance(data.cbegin(), first)),
+          static_cast<size_t>(std::distance(data.cbegin(), last))};
+}
+
+/// @return the extents of the box as the space for its Morton ordering
+TMDE(morton_index::MDSpaceBounds<nd> MDBox)::getMortonSpace() const {
+  morton_index::MDSpaceBounds<nd> space;
+  for (size_t d = 0; d < nd; ++d) {
+    space(d, 0) = this->extents[d].getMin();
+    space(d, 1) = this->extents[d].getMax();
+  }
+  return space;
+}
+
+/** Convert a point within the box to the integer coordinates used to find its
+ * position along the Morton curve
+ * @param center :: nd-sized array with the coordinates of the point
+ * @param space :: extents of the box, see getMortonSpace()
+ * @return the integer coordinates of the point
+ */
+template <typename MDE, size_t nd>
+typename MDBox<MDE, nd>::MortonCoordinates
+MDBox<MDE, nd>::toMortonCoordinates(
+    const coord_t *center, const morton_index::MDSpaceBounds<nd> &space) {
+  using IntT = typename MDE::IntT;
+  return morton_index::ConvertCoordinatesToIntegerRange<nd, IntT>(space,
+                                                                  center);
+}
+
 /// Setter for masking the box
 TMDE(void MDBox)::mask() {
   this->setSignal(API::MDMaskValue);
@@ -783,6 +897,7 @@ TMDE(size_t MDBox)::buildAndAddEvents(const std::vector<signal_t> &sigErrSq,
   data.reserve(nExisiting + nEvents);
   std::lock_guard<std::mutex> _lock(this->m_dataMutex);
   IF<MDE, nd>::EXEC(this->data, sigErrSq, Coord, runIndex, detectorId, nEvents);
+  m_sortedByMortonIndex = false;
 
   return 0;
 }
@@ -801,6 +916,7 @@ TMDE(void MDBox)::buildAndAddEvent(const signal_t Signal,
   std::lock_guard<std::mutex> _lock(this->m_dataMutex);
   this->data.emplace_back(IF<MDE, nd>::BUILD_EVENT(Signal, errorSq, &point[0],
                                                    runIndex, detectorId));
+  m_sortedByMortonIndex = false;
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -821,6 +937,7 @@ TMDE(void MDBox)::buildAndAddEventUnsafe(const signal_t Signal,
                                          uint32_t detectorId) {
   this->data.emplace_back(IF<MDE, nd>::BUILD_EVENT(Signal, errorSq, &point[0],
                                                    runIndex, detectorId));
+  m_sortedByMortonIndex = false;
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -831,6 +948,7 @@ TMDE(void MDBox)::buildAndAddEventUnsafe(const signal_t Signal,
 TMDE(size_t MDBox)::addEvent(const MDE &Evnt) {
   std::lock_guard<std::mutex> _lock(this->m_dataMutex);
   this->data.emplace_back(Evnt);
+  m_sortedByMortonIndex = false;
   return 1;
 }
 
@@ -844,6 +962,7 @@ TMDE(size_t MDBox)::addEvent(const MDE &Evnt) {
  * */
 TMDE(size_t MDBox)::addEventUnsafe(const MDE &Evnt) {
   this->data.emplace_back(Evnt);
+  m_sortedByMortonIndex = false;
   return 1;
 }
 
@@ -858,6 +977,7 @@ TMDE(size_t MDBox)::addEvents(const std::vector<MDE> &events) {
   std::lock_guard<std::mutex> _lock(this->m_dataMutex);
   // Copy all the events
   this->data.insert(this->data.end(), events.cbegin(), events.cend());
+  m_sortedByMortonIndex = false;
   return 0;
 }
 
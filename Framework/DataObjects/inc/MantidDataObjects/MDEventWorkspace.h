@@ -148,6 +148,8 @@ public:
 
   void refreshCache() override;
 
+  void sortEventsByMortonIndex();
+
   std::string getEventTypeName() const override;
   /// return the size (in bytes) of an event, this workspace contains
   size_t sizeofEvent() const override { return sizeof(MDE); }
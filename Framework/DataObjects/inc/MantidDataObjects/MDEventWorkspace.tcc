@@ -666,6 +666,24 @@ TMDE(void MDEventWorkspace)::refreshCache() {
   // TODO ThreadPool
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Sort the events of every leaf box by their Morton index, so that
+ * axis-aligned queries can scan a contiguous range of each box's events.
+ * See MDBox::sortEventsByMortonIndex(). Not done for file-backed workspaces.
+ */
+TMDE(void MDEventWorkspace)::sortEventsByMortonIndex() {
+  if (this->isFileBacked())
+    return;
+  std::vector<API::IMDNode *> boxes;
+  this->data->getBoxes(boxes, 10000, true);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < static_cast<int>(boxes.size()); ++i) {
+    auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[i]);
+    if (box)
+      box->sortEventsByMortonIndex();
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 /** Get ordered list of positions-along-the-line that lie halfway between points
  *where the line crosses box boundaries
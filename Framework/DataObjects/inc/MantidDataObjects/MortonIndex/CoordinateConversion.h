@@ -30,6 +30,37 @@ bool morton_contains(const MortonT lower, const MortonT upper,
   return lower <= value && value <= upper;
 }
 
+/**
+ * Compares two points given in integer coordinates by their order along the
+ * Morton (Z-order) curve, without interleaving the coordinates. This works
+ * for any number of dimensions and integer width, including those for which
+ * no interleaving specialisation exists.
+ *
+ * The order matches interleave(): at equal bit significance the higher
+ * dimension is the more significant.
+ *
+ * @param a First point
+ * @param b Second point
+ * @return true if a comes before b along the curve
+ */
+template <size_t ND, typename IntT>
+bool morton_less(const IntArray<ND, IntT> &a, const IntArray<ND, IntT> &b) {
+  // true if the highest set bit of x is lower than the highest set bit of y
+  const auto lessMostSignificantBit = [](const IntT x, const IntT y) {
+    return x < y && x < static_cast<IntT>(x ^ y);
+  };
+  size_t dim = 0;
+  IntT dimBits = 0;
+  for (size_t i = 0; i < ND; ++i) {
+    const auto bits = static_cast<IntT>(a[i] ^ b[i]);
+    if (!lessMostSignificantBit(bits, dimBits)) {
+      dim = i;
+      dimBits = bits;
+    }
+  }
+  return a[dim] < b[dim];
+}
+
 template <size_t ND, typename IntT, typename MortonT>
 MortonT calculateDefaultBound(IntT intBound) {
   IntArray<ND, IntT> minCoord;
@@ -94,23 +125,27 @@ bool CheckCoordinatesInMDSpace(const MDSpaceBounds<ND> &bounds,
 
 /**
  * Converts a point to integer range given a range of floating point
- * coordinates.
+ * coordinates. Points outside the bounds are clamped onto them. The scaling is
+ * done in double precision and clamped before the cast, since the maximum of
+ * the integer type rounds up to the next power of two as a float (or as a
+ * double for 64 bit integers) and converting it back would overflow.
  */
 template <int ND, typename IntT>
 Eigen::Array<IntT, ND, 1>
 ConvertCoordinatesToIntegerRange(const MDSpaceBounds<ND> &bounds,
                                  const float *crd) {
-  MDCoordinate<ND> coord(crd);
-  const MDCoordinate<ND> range = bounds.col(1) - bounds.col(0);
-  const MDCoordinate<ND> coordFactorOfRange = (coord - bounds.col(0)) / range;
-  const MDCoordinate<ND> n =
-      coordFactorOfRange * std::numeric_limits<IntT>::max();
-  Eigen::Array<IntT, ND, 1> res = n.template cast<IntT>();
-  for (unsigned i = 0; i < ND; ++i)
-    if (coord[i] == bounds(i, 1))
-      res[i] = std::numeric_limits<IntT>::max();
-    else if (coord[i] == bounds(i, 0))
-      res[i] = 0;
+  const auto intMax = std::numeric_limits<IntT>::max();
+  const auto scale = static_cast<double>(intMax);
+  Eigen::Array<IntT, ND, 1> res;
+  for (unsigned i = 0; i < ND; ++i) {
+    const double lower = bounds(i, 0);
+    const double range = static_cast<double>(bounds(i, 1)) - lower;
+    const double coordFactorOfRange =
+        std::clamp((static_cast<double>(crd[i]) - lower) / range, 0., 1.);
+    const double n = coordFactorOfRange * scale;
+    // NaN (e.g. from an empty range) fails the comparison as well
+    res[i] = n < scale ? static_cast<IntT>(n) : intMax;
+  }
   return res;
 }
 
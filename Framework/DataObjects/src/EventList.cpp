@@ -23,6 +23,8 @@
 #pragma warning(default : 4180)
 #endif
 
+#include <algorithm>
+#include <array>
 #include <cfloat>
 #include <cmath>
 #include <functional>
@@ -44,6 +46,22 @@ namespace {
 
 const double SEC_TO_NANO = 1.e9;
 
+/**
+ * Make room for at least the given number of elements.
+ * @param vec : The vector to reserve memory in
+ * @param size : The required capacity
+ * @param growGeometrically : If true, the capacity is at least doubled when
+ * growing, such that repeatedly adding small lists to one accumulating list
+ * costs amortized linear time, as with push_back. Otherwise exactly the
+ * required capacity is reserved.
+ */
+template <typename T>
+void reserveEvents(std::vector<T> &vec, size_t size, bool growGeometrically) {
+  if (vec.capacity() >= size)
+    return;
+  vec.reserve(growGeometrically ? std::max(2 * vec.capacity(), size) : size);
+}
+
 /**
  * Calculate the corrected full time in nanoseconds
  * @param event : The event with pulse time and time-of-flight
@@ -492,35 +510,141 @@ operator+=(const std::vector<WeightedEventNoTime> &more_events) {
 /** Append another EventList to this event list.
  * The event lists are concatenated, and a union of the sets of detector ID's is
  *done.
- * Switching of event types may occur if the two are different.
+ * Switching of event types may occur if the two are different. If both lists
+ *are sorted by TOF they are merged so that the result stays sorted.
+ * Exactly the combined number of events is reserved; use accumulate() to add
+ * many lists into this one.
  *
  * @param more_events :: Another EventList.
  * @return reference to this
  * */
 EventList &EventList::operator+=(const EventList &more_events) {
-  // We'll let the += operator for the given vector of event lists handle it
-  switch (more_events.getEventType()) {
+  return addEventList(more_events, false);
+}
+
+// --------------------------------------------------------------------------
+/** Append another EventList to this event list, as operator+= does, for
+ * adding many lists into this one. The storage grows geometrically, so that
+ * repeated additions cost amortized linear time instead of copying the whole
+ * list each time.
+ *
+ * @param more_events :: Another EventList.
+ * @return reference to this
+ * */
+EventList &EventList::accumulate(const EventList &more_events) {
+  return addEventList(more_events, true);
+}
+
+/** Implementation of operator+= and accumulate()
+ *
+ * @param more_events :: Another EventList.
+ * @param growGeometrically :: If true, at least double the capacity when it
+ * is too small, otherwise reserve the combined number of events exactly.
+ * @return reference to this
+ * */
+EventList &EventList::addEventList(const EventList &more_events,
+                                   bool growGeometrically) {
+  if (this == &more_events) {
+    // Appending to itself: take a copy so the events being read stay put
+    const EventList copy(more_events);
+    return this->addEventList(copy, growGeometrically);
+  }
+
+  const bool merge = this->order == TOF_SORT && more_events.order == TOF_SORT;
+  // Convert the events already there straight into a vector with room for
+  // both lists
+  reserveAndSwitchTo(std::max(eventType, more_events.getEventType()),
+                     getNumberEvents() + more_events.getNumberEvents(),
+                     growGeometrically);
+
+  switch (this->eventType) {
   case TOF:
-    this->operator+=(more_events.events);
+    plusHelper(this->events, more_events.events, merge);
     break;
 
   case WEIGHTED:
-    this->operator+=(more_events.weightedEvents);
+    if (more_events.getEventType() == TOF)
+      plusHelper(this->weightedEvents, more_events.events, merge);
+    else
+      plusHelper(this->weightedEvents, more_events.weightedEvents, merge);
     break;
 
   case WEIGHTED_NOTIME:
-    this->operator+=(more_events.weightedEventsNoTime);
+    switch (more_events.getEventType()) {
+    case TOF:
+      plusHelper(this->weightedEventsNoTime, more_events.events, merge);
+      break;
+    case WEIGHTED:
+      plusHelper(this->weightedEventsNoTime, more_events.weightedEvents, merge);
+      break;
+    case WEIGHTED_NOTIME:
+      plusHelper(this->weightedEventsNoTime, more_events.weightedEventsNoTime,
+                 merge);
+      break;
+    }
     break;
   }
 
-  // No guaranteed order
-  this->order = UNSORTED;
+  this->order = merge ? TOF_SORT : UNSORTED;
   // Do a union between the detector IDs of both lists
   addDetectorIDs(more_events.getDetectorIDs());
 
   return *this;
 }
 
+namespace {
+/** Append events converted by a function to a vector. If merge is true, both
+ * vectors are sorted by TOF and the events are merged so that the result is
+ * sorted too; among events with equal TOF the ones already in the vector come
+ * first. The merge runs from the back so it needs no extra buffer.
+ *
+ * @param events :: The event vector being changed.
+ * @param more_events :: The events to add.
+ * @param convert :: Returns the event to add for each of more_events.
+ * @param merge :: True to merge two vectors sorted by TOF.
+ */
+template <class T1, class T2, class Convert>
+void appendEvents(std::vector<T1> &events, const std::vector<T2> &more_events,
+                  Convert convert, const bool merge) {
+  const size_t numOld = events.size();
+  const size_t numMore = more_events.size();
+  if (!merge || numOld == 0 || numMore == 0 ||
+      !(more_events.front().tof() < events.back().tof())) {
+    // Appending keeps any order
+    events.reserve(numOld + numMore);
+    for (const auto &event : more_events)
+      events.emplace_back(convert(event));
+    return;
+  }
+  events.resize(numOld + numMore);
+  size_t old = numOld;
+  size_t more = numMore;
+  size_t next = numOld + numMore;
+  while (more > 0) {
+    if (old > 0 && more_events[more - 1].tof() < events[old - 1].tof())
+      events[--next] = events[--old];
+    else
+      events[--next] = convert(more_events[--more]);
+  }
+}
+} // namespace
+
+// --------------------------------------------------------------------------
+/** ADD another event vector to this one.
+ *
+ * @tparam T1, T2 :: TofEvent, WeightedEvent or WeightedEventNoTime
+ * @param events :: The event vector being changed.
+ * @param more_events :: Another event vector being added to this.
+ * @param merge :: True if both vectors are sorted by TOF and should be merged.
+ * */
+template <class T1, class T2>
+void EventList::plusHelper(std::vector<T1> &events,
+                           const std::vector<T2> &more_events,
+                           const bool merge) {
+  appendEvents(events, more_events, [](const T2 &ev) { return T1(ev); },
+               merge);
+}
+
 // --------------------------------------------------------------------------
 /** SUBTRACT another EventList from this event list.
  * The event lists are concatenated, but the weights of the incoming
@@ -529,24 +653,20 @@ EventList &EventList::operator+=(const EventList &more_events) {
  * @tparam T1, T2 :: TofEvent, WeightedEvent or WeightedEventNoTime
  * @param events :: The event vector being changed.
  * @param more_events :: Another event vector being subtracted from this.
- * @return reference to this
+ * @param merge :: True if both vectors are sorted by TOF and should be merged.
  * */
 template <class T1, class T2>
 void EventList::minusHelper(std::vector<T1> &events,
-                            const std::vector<T2> &more_events) {
-  // Make the end vector big enough in one go (avoids repeated re-allocations).
-  events.reserve(events.size() + more_events.size());
-  /* In the event of subtracting in place, calling the end() vector would make
-   * it point at the wrong place
-   * Using it caused a segault, Ticket #2306.
-   * So we cache the end (this speeds up too).
-   */
-  for (const auto &ev : more_events) {
-    // We call the constructor for T1. In the case of WeightedEventNoTime, the
-    // pulse time will just be ignored.
-    events.emplace_back(ev.tof(), ev.pulseTime(), ev.weight() * (-1.0),
-                        ev.errorSquared());
-  }
+                            const std::vector<T2> &more_events,
+                            const bool merge) {
+  // We call the constructor for T1. In the case of WeightedEventNoTime, the
+  // pulse time will just be ignored.
+  appendEvents(events, more_events,
+               [](const T2 &ev) {
+                 return T1(ev.tof(), ev.pulseTime(), ev.weight() * (-1.0),
+                           ev.errorSquared());
+               },
+               merge);
 }
 
 // --------------------------------------------------------------------------
@@ -566,23 +686,29 @@ EventList &EventList::operator-=(const EventList &more_events) {
     return *this;
   }
 
-  // We'll let the -= operator for the given vector of event lists handle it
+  const bool merge = this->order == TOF_SORT && more_events.order == TOF_SORT;
+  // The subtracted events need weights. Convert the events already there
+  // straight into a vector with room for both lists.
+  reserveAndSwitchTo(std::max(eventType, WEIGHTED),
+                     getNumberEvents() + more_events.getNumberEvents());
+
   switch (this->getEventType()) {
   case TOF:
-    this->switchTo(WEIGHTED);
-    // Fall through
+    // Cannot happen, the list has weights now
+    break;
 
   case WEIGHTED:
     switch (more_events.getEventType()) {
     case TOF:
-      minusHelper(this->weightedEvents, more_events.events);
+      minusHelper(this->weightedEvents, more_events.events, merge);
       break;
     case WEIGHTED:
-      minusHelper(this->weightedEvents, more_events.weightedEvents);
+      minusHelper(this->weightedEvents, more_events.weightedEvents, merge);
       break;
     case WEIGHTED_NOTIME:
       // TODO: Should this throw?
-      minusHelper(this->weightedEvents, more_events.weightedEventsNoTime);
+      minusHelper(this->weightedEvents, more_events.weightedEventsNoTime,
+                  merge);
       break;
     }
     break;
@@ -590,20 +716,22 @@ EventList &EventList::operator-=(const EventList &more_events) {
   case WEIGHTED_NOTIME:
     switch (more_events.getEventType()) {
     case TOF:
-      minusHelper(this->weightedEventsNoTime, more_events.events);
+      minusHelper(this->weightedEventsNoTime, more_events.events, merge);
       break;
     case WEIGHTED:
-      minusHelper(this->weightedEventsNoTime, more_events.weightedEvents);
+      minusHelper(this->weightedEventsNoTime, more_events.weightedEvents,
+                  merge);
       break;
     case WEIGHTED_NOTIME:
-      minusHelper(this->weightedEventsNoTime, more_events.weightedEventsNoTime);
+      minusHelper(this->weightedEventsNoTime, more_events.weightedEventsNoTime,
+                  merge);
       break;
     }
     break;
   }
 
-  // No guaranteed order
-  this->order = UNSORTED;
+  // Merging sorted lists keeps the order
+  this->order = merge ? TOF_SORT : UNSORTED;
 
   // NOTE: What to do about detector ID's?
   return *this;
@@ -708,6 +836,34 @@ void EventList::switchTo(EventType newType) {
   this->clearUnused();
 }
 
+// -----------------------------------------------------------------------------------------------
+/** Switch the EventList to use the given EventType, making room for a number
+ * of events first. The events already in the list are converted into the
+ * reserved vector, so appending up to that number of events afterwards does
+ * not reallocate.
+ *
+ * @param newType :: The event type to switch to. It must not drop information.
+ * @param numEvents :: The number of events to make room for.
+ * @param growGeometrically :: If true, at least double the capacity when it is
+ * too small, for lists that many other lists are added to.
+ */
+void EventList::reserveAndSwitchTo(EventType newType, size_t numEvents,
+                                   bool growGeometrically) {
+  switch (newType) {
+  case TOF:
+    reserveEvents(this->events, numEvents, growGeometrically);
+    break;
+  case WEIGHTED:
+    reserveEvents(this->weightedEvents, numEvents, growGeometrically);
+    break;
+  case WEIGHTED_NOTIME:
+    reserveEvents(this->weightedEventsNoTime, numEvents, growGeometrically);
+    break;
+  }
+  if (newType != eventType)
+    this->switchTo(newType);
+}
+
 // -----------------------------------------------------------------------------------------------
 /** Switch the EventList to use WeightedEvents instead
  * of TofEvent.
@@ -4819,7 +4975,8 @@ void getEventsFrom(const EventList &el,
 
 //--------------------------------------------------------------------------
 /** Helper function for the conversion to TOF. This handles the different
- *  event types.
+ *  event types. The events are converted in blocks so that each unit converts
+ *  a whole array per call, rather than making a virtual call per event.
  *
  * @param events the list of events
  * @param fromUnit the unit to convert from
@@ -4829,13 +4986,18 @@ template <class T>
 void EventList::convertUnitsViaTofHelper(typename std::vector<T> &events,
                                          Mantid::Kernel::Unit *fromUnit,
                                          Mantid::Kernel::Unit *toUnit) {
-  auto itev = events.begin();
-  auto itev_end = events.end();
-  for (; itev != itev_end; itev++) {
-    // Conver to TOF
-    double tof = fromUnit->singleToTOF(itev->m_tof);
-    // And back from TOF to whatever
-    itev->m_tof = toUnit->singleFromTOF(tof);
+  constexpr size_t blockSize = 1024;
+  std::array<double, blockSize> block;
+  for (size_t start = 0; start < events.size(); start += blockSize) {
+    const size_t count = std::min(blockSize, events.size() - start);
+    auto itev = events.begin() + start;
+    for (size_t i = 0; i < count; ++i)
+      block[i] = itev[i].m_tof;
+    // Convert to TOF and back from TOF to whatever
+    fromUnit->batchToTOF(block.data(), block.data() + count);
+    toUnit->batchFromTOF(block.data(), block.data() + count);
+    for (size_t i = 0; i < count; ++i)
+      itev[i].m_tof = block[i];
   }
 }
 
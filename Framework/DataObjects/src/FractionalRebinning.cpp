@@ -10,8 +10,10 @@
 #include "MantidGeometry/Math/ConvexPolygon.h"
 #include "MantidGeometry/Math/PolygonIntersection.h"
 #include "MantidGeometry/Math/Quadrilateral.h"
+#include "MantidKernel/Memory.h"
 #include "MantidKernel/V2D.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -586,28 +588,28 @@ void rebinToOutput(const Quadrilateral &inputQ,
 }
 
 /**
- * Rebin the input quadrilateral to the output grid
- * The quadrilateral must have a CLOCKWISE winding.
+ * Compute the contributions of an input quadrilateral to the output grid and
+ * pass them to an accumulator
  * @param inputQ The input polygon (Polygon winding must be clockwise)
  * @param inputWS The input workspace containing the input intensity values
- * @param i The indexiin the vertical axis direction that inputQ references
+ * @param i The index in the vertical axis direction that inputQ references
  * @param j The index in the horizontal axis direction that inputQ references
- * @param outputWS A pointer to the output workspace that accumulates the data
- *        Note that the error array of the output workspace contains the
- *        **variance** and not the errors (standard deviations).
+ * @param X The output horizontal axis bin boundaries
  * @param verticalAxis A vector containing the output vertical axis bin
  * boundaries
- * @param inputRB A pointer, of RebinnedOutput type, to the input workspace.
- * It is used to take into account the input area fractions when calcuting
- * the final output fractions.
- * This can be null to indicate that the input was a standard 2D workspace.
+ * @param inputRB A pointer, of RebinnedOutput type, to the input workspace,
+ * or null if the input was a standard 2D workspace
+ * @param accumulate Called with the output workspace index, bin index,
+ * signal, variance and fraction of each contribution
  */
-void rebinToFractionalOutput(const Quadrilateral &inputQ,
-                             const MatrixWorkspace_const_sptr &inputWS,
-                             const size_t i, const size_t j,
-                             RebinnedOutput &outputWS,
-                             const std::vector<double> &verticalAxis,
-                             const RebinnedOutput_const_sptr &inputRB) {
+template <typename Accumulator>
+void accumulateFractionalOutput(const Quadrilateral &inputQ,
+                                const MatrixWorkspace_const_sptr &inputWS,
+                                const size_t i, const size_t j,
+                                const std::vector<double> &X,
+                                const std::vector<double> &verticalAxis,
+                                const RebinnedOutput_const_sptr &inputRB,
+                                Accumulator &&accumulate) {
   const auto &inX = inputWS->x(i);
   const auto &inY = inputWS->y(i);
   const auto &inE = inputWS->e(i);
@@ -615,7 +617,6 @@ void rebinToFractionalOutput(const Quadrilateral &inputQ,
   if (std::isnan(signal))
     return;
 
-  const auto &X = outputWS.x(0).rawData();
   size_t qstart(0), qend(verticalAxis.size() - 1), x_start(0),
       x_end(X.size() - 1);
   if (!getIntersectionRegion(X, verticalAxis, inputQ, qstart, qend, x_start,
@@ -674,17 +675,134 @@ void rebinToFractionalOutput(const Quadrilateral &inputQ,
       continue;
     }
     const double weight = ai.weight / inputQArea;
-    PARALLEL_CRITICAL(overlap) {
-      // The mutable calls must be in the critical section
-      // so that any calls from omp sections can write to the
-      // output workspace safely
-      outputWS.mutableY(ai.wsIndex)[ai.binIndex] += signal * weight;
-      outputWS.mutableE(ai.wsIndex)[ai.binIndex] += variance * weight;
-      outputWS.dataF(ai.wsIndex)[ai.binIndex] += weight * inputWeight;
+    accumulate(ai.wsIndex, ai.binIndex, signal * weight, variance * weight,
+               weight * inputWeight);
+  }
+}
+
+/**
+ * Rebin the input quadrilateral to the output grid
+ * The quadrilateral must have a CLOCKWISE winding.
+ * @param inputQ The input polygon (Polygon winding must be clockwise)
+ * @param inputWS The input workspace containing the input intensity values
+ * @param i The indexiin the vertical axis direction that inputQ references
+ * @param j The index in the horizontal axis direction that inputQ references
+ * @param outputWS A pointer to the output workspace that accumulates the data
+ *        Note that the error array of the output workspace contains the
+ *        **variance** and not the errors (standard deviations).
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ * @param inputRB A pointer, of RebinnedOutput type, to the input workspace.
+ * It is used to take into account the input area fractions when calcuting
+ * the final output fractions.
+ * This can be null to indicate that the input was a standard 2D workspace.
+ */
+void rebinToFractionalOutput(const Quadrilateral &inputQ,
+                             const MatrixWorkspace_const_sptr &inputWS,
+                             const size_t i, const size_t j,
+                             RebinnedOutput &outputWS,
+                             const std::vector<double> &verticalAxis,
+                             const RebinnedOutput_const_sptr &inputRB) {
+  accumulateFractionalOutput(
+      inputQ, inputWS, i, j, outputWS.x(0).rawData(), verticalAxis, inputRB,
+      [&outputWS](const size_t wsIndex, const size_t binIndex,
+                  const double signal, const double variance,
+                  const double fraction) {
+        PARALLEL_CRITICAL(overlap) {
+          // The mutable calls must be in the critical section
+          // so that any calls from omp sections can write to the
+          // output workspace safely
+          outputWS.mutableY(wsIndex)[binIndex] += signal;
+          outputWS.mutableE(wsIndex)[binIndex] += variance;
+          outputWS.dataF(wsIndex)[binIndex] += fraction;
+        }
+      });
+}
+
+/**
+ * Rebin the input quadrilateral to the output grid, accumulating into a
+ * buffer rather than the output workspace. No lock is taken, so each thread
+ * must fill its own buffer.
+ * @param inputQ The input polygon (Polygon winding must be clockwise)
+ * @param inputWS The input workspace containing the input intensity values
+ * @param i The index in the vertical axis direction that inputQ references
+ * @param j The index in the horizontal axis direction that inputQ references
+ * @param outputWS The output workspace, only used for its binning
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ * @param buffer The buffer that accumulates the data
+ * @param inputRB A pointer, of RebinnedOutput type, to the input workspace,
+ * or null if the input was a standard 2D workspace
+ */
+void rebinToFractionalOutput(const Quadrilateral &inputQ,
+                             const MatrixWorkspace_const_sptr &inputWS,
+                             const size_t i, const size_t j,
+                             const RebinnedOutput &outputWS,
+                             const std::vector<double> &verticalAxis,
+                             FractionalRebinningBuffer &buffer,
+                             const RebinnedOutput_const_sptr &inputRB) {
+  accumulateFractionalOutput(
+      inputQ, inputWS, i, j, outputWS.x(0).rawData(), verticalAxis, inputRB,
+      [&buffer](const size_t wsIndex, const size_t binIndex,
+                const double signal, const double variance,
+                const double fraction) {
+        buffer.add(wsIndex, binIndex, signal, variance, fraction);
+      });
+}
+
+/**
+ * Constructor
+ * @param numberHistograms The number of histograms of the output workspace
+ * @param numberBins The number of bins of the output workspace
+ */
+FractionalRebinningBuffer::FractionalRebinningBuffer(
+    const size_t numberHistograms, const size_t numberBins)
+    : m_numberBins(numberBins), m_signal(numberHistograms * numberBins, 0.),
+      m_variance(numberHistograms * numberBins, 0.),
+      m_fraction(numberHistograms * numberBins, 0.) {}
+
+/**
+ * Add the accumulated signal, variance and fractions to a workspace
+ * @param outputWS The workspace to add to, of the size given on construction
+ */
+void FractionalRebinningBuffer::addTo(RebinnedOutput &outputWS) const {
+  const auto numberHistograms = m_signal.size() / m_numberBins;
+  for (size_t wsIndex = 0; wsIndex < numberHistograms; ++wsIndex) {
+    const size_t offset = wsIndex * m_numberBins;
+    auto &Y = outputWS.mutableY(wsIndex);
+    auto &E = outputWS.mutableE(wsIndex);
+    auto &F = outputWS.dataF(wsIndex);
+    for (size_t binIndex = 0; binIndex < m_numberBins; ++binIndex) {
+      Y[binIndex] += m_signal[offset + binIndex];
+      E[binIndex] += m_variance[offset + binIndex];
+      F[binIndex] += m_fraction[offset + binIndex];
     }
   }
 }
 
+/**
+ * Each buffer holds three values per output bin, so concurrent buffers for
+ * many threads and a large output can use much more memory than the output
+ * itself. The buffers are limited to half of the available memory, and to
+ * 1 GiB in total, but at least one buffer is always allowed.
+ * @param numberHistograms The number of histograms of the output workspace
+ * @param numberBins The number of bins of the output workspace
+ * @param maxBuffers The number of buffers wanted, e.g., the number of threads
+ * @return The number of buffers to use, between 1 and maxBuffers
+ */
+size_t FractionalRebinningBuffer::maxNumberOfBuffers(
+    const size_t numberHistograms, const size_t numberBins,
+    const size_t maxBuffers) {
+  constexpr size_t maxBufferMemory = size_t{1} << 30;
+  const size_t bufferSize = 3 * sizeof(double) * numberHistograms * numberBins;
+  if (maxBuffers <= 1 || bufferSize == 0)
+    return std::max(maxBuffers, size_t{1});
+  Kernel::MemoryStats memoryStats;
+  const size_t availableMemory = memoryStats.availMem() * 1024 / 2;
+  const size_t budget = std::min(maxBufferMemory, availableMemory);
+  return std::max(std::min(maxBuffers, budget / bufferSize), size_t{1});
+}
+
 /**
  * Called at the completion of the fractional rebinning loop
  * to the set the finalize flag in the output workspace.
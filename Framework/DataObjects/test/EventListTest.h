@@ -381,6 +381,85 @@ public:
     }
   }
 
+  void test_adding_sorted_lists_merges_them() {
+    for (int i = 0; i < 3; i++) {
+      for (int j = 0; j < 3; j++) {
+        EventList lhs, rhs;
+        lhs += vector<TofEvent>{{1, 10}, {3, 30}, {5, 50}};
+        rhs += vector<TofEvent>{{2, 20}, {3, 31}, {6, 60}};
+        lhs.switchTo(static_cast<EventType>(i));
+        rhs.switchTo(static_cast<EventType>(j));
+        lhs.sortTof();
+        rhs.sortTof();
+
+        lhs += rhs;
+
+        TS_ASSERT_EQUALS(lhs.getSortType(), TOF_SORT);
+        TS_ASSERT_EQUALS(lhs.getNumberEvents(), 6);
+        const std::vector<double> expected{1, 2, 3, 3, 5, 6};
+        for (size_t k = 0; k < expected.size(); ++k)
+          TS_ASSERT_EQUALS(lhs.getEvent(k).tof(), expected[k]);
+        if (i != static_cast<int>(WEIGHTED_NOTIME) &&
+            j != static_cast<int>(WEIGHTED_NOTIME)) {
+          // The lhs event comes first among equal TOFs
+          TS_ASSERT_EQUALS(lhs.getEvent(2).pulseTime(), DateAndTime(30));
+          TS_ASSERT_EQUALS(lhs.getEvent(3).pulseTime(), DateAndTime(31));
+        }
+      }
+    }
+  }
+
+  void test_accumulating_many_small_lists_grows_capacity_geometrically() {
+    for (int i = 0; i < 3; i++) {
+      EventList sum;
+      sum.switchTo(static_cast<EventType>(i));
+      EventList small;
+      small += vector<TofEvent>{{1, 10}, {2, 20}};
+      small.switchTo(static_cast<EventType>(i));
+      size_t reallocations = 0;
+      size_t capacity = 0;
+      for (int k = 0; k < 1000; ++k) {
+        sum.accumulate(small);
+        const auto newCapacity = capacityOf(sum);
+        if (newCapacity != capacity)
+          ++reallocations;
+        capacity = newCapacity;
+      }
+      TS_ASSERT_EQUALS(sum.getNumberEvents(), 2000);
+      // Reserving exactly the new size would reallocate on every addition
+      TS_ASSERT_LESS_THAN(reallocations, 15);
+    }
+  }
+
+  void test_adding_a_list_reserves_exactly_the_combined_size() {
+    for (int i = 0; i < 3; i++) {
+      EventList large;
+      large += vector<TofEvent>(1000, TofEvent(1, 10));
+      large.switchTo(static_cast<EventType>(i));
+      EventList small;
+      small += vector<TofEvent>{{1, 10}, {2, 20}};
+      small.switchTo(static_cast<EventType>(i));
+      EventList lhs;
+      lhs.switchTo(static_cast<EventType>(i));
+      lhs += large;
+      lhs += small;
+      TS_ASSERT_EQUALS(lhs.getNumberEvents(), 1002);
+      TS_ASSERT_EQUALS(capacityOf(lhs), 1002);
+    }
+  }
+
+  void test_adding_unsorted_lists_appends_them() {
+    EventList lhs, rhs;
+    lhs += vector<TofEvent>{{1, 10}, {5, 50}};
+    rhs += vector<TofEvent>{{2, 20}, {6, 60}};
+    lhs.sortTof();
+    lhs += rhs;
+    TS_ASSERT_EQUALS(lhs.getSortType(), UNSORTED);
+    const std::vector<double> expected{1, 5, 2, 6};
+    for (size_t k = 0; k < expected.size(); ++k)
+      TS_ASSERT_EQUALS(lhs.getEvent(k).tof(), expected[k]);
+  }
+
   //==================================================================================
   //--- Minus Operation ----
   //==================================================================================
@@ -422,6 +501,28 @@ public:
     }
   }
 
+  void test_subtracting_sorted_lists_merges_them() {
+    EventList lhs, rhs;
+    lhs += vector<TofEvent>{{1, 10}, {4, 40}};
+    rhs += vector<TofEvent>{{2, 20}, {4, 41}, {5, 50}};
+    lhs.sortTof();
+    rhs.sortTof();
+
+    lhs -= rhs;
+
+    TS_ASSERT_EQUALS(lhs.getEventType(), WEIGHTED);
+    TS_ASSERT_EQUALS(lhs.getSortType(), TOF_SORT);
+    const auto &events = lhs.getWeightedEvents();
+    TS_ASSERT_EQUALS(events.size(), 5);
+    const std::vector<double> tofs{1, 2, 4, 4, 5};
+    const std::vector<double> weights{1, -1, 1, -1, -1};
+    for (size_t k = 0; k < tofs.size(); ++k) {
+      TS_ASSERT_EQUALS(events[k].tof(), tofs[k]);
+      TS_ASSERT_EQUALS(events[k].weight(), weights[k]);
+      TS_ASSERT_EQUALS(events[k].errorSquared(), 1.);
+    }
+  }
+
   /** Perform THIS -= THIS, e.g. clear the event list */
   void test_MinusOperator_inPlace_3cases() {
     EventList lhs, rhs;
@@ -2872,6 +2973,19 @@ public:
     TS_ASSERT_EQUALS(freqHist.counts()[0], 4.0);
     TS_ASSERT_EQUALS(freqHist.counts()[1], 2.0);
   }
+
+private:
+  size_t capacityOf(EventList &list) {
+    switch (list.getEventType()) {
+    case TOF:
+      return list.getEvents().capacity();
+    case WEIGHTED:
+      return list.getWeightedEvents().capacity();
+    case WEIGHTED_NOTIME:
+      return list.getWeightedEventsNoTime().capacity();
+    }
+    return 0;
+  }
 };
 
 //==========================================================================================
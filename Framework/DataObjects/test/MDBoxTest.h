@@ -328,6 +328,60 @@ public:
     b.releaseEvents();
   }
 
+  void test_sortEventsByMortonIndex_and_getEventRangeInBounds() {
+    BoxController_sptr sc(new BoxController(2));
+    std::vector<MDDimensionExtents<coord_t>> extents(2);
+    extents[0].setExtents(0, 10);
+    extents[1].setExtents(0, 10);
+    MDBox<MDLeanEvent<2>, 2> b(sc.get(), 0, extents);
+    MDLeanEvent<2> ev(1.0, 1.0);
+    // Add a grid of events, in reverse order
+    for (int x = 9; x >= 0; --x)
+      for (int y = 9; y >= 0; --y) {
+        ev.setCenter(0, static_cast<coord_t>(x) + 0.5f);
+        ev.setCenter(1, static_cast<coord_t>(y) + 0.5f);
+        b.addEvent(ev);
+      }
+
+    const coord_t min[2] = {2.0f, 6.0f};
+    const coord_t max[2] = {4.0f, 7.0f};
+    // Unsorted boxes give back all of the events
+    auto range = b.getEventRangeInBounds(min, max);
+    TS_ASSERT_EQUALS(range.first, 0);
+    TS_ASSERT_EQUALS(range.second, 100);
+
+    b.sortEventsByMortonIndex();
+    TS_ASSERT(b.isSortedByMortonIndex());
+    TS_ASSERT_EQUALS(b.getNPoints(), 100);
+    const auto &events = b.getConstEvents();
+    range = b.getEventRangeInBounds(min, max);
+    TS_ASSERT_LESS_THAN(range.second - range.first, 100);
+    // All events within the bounds are inside the range
+    size_t numInside = 0;
+    for (size_t i = 0; i < events.size(); ++i) {
+      const coord_t x = events[i].getCenter(0);
+      const coord_t y = events[i].getCenter(1);
+      const bool inside =
+          x >= min[0] && x <= max[0] && y >= min[1] && y <= max[1];
+      if (inside) {
+        ++numInside;
+        TS_ASSERT(i >= range.first && i < range.second);
+      }
+    }
+    TS_ASSERT_EQUALS(numInside, 2);
+    b.releaseEvents();
+
+    // A region outside the box is empty
+    const coord_t outsideMin[2] = {11.0f, 0.0f};
+    const coord_t outsideMax[2] = {12.0f, 10.0f};
+    range = b.getEventRangeInBounds(outsideMin, outsideMax);
+    TS_ASSERT_EQUALS(range.first, range.second);
+
+    // Adding events loses the ordering
+    b.addEvent(ev);
+    TS_ASSERT(!b.isSortedByMortonIndex());
+  }
+
   void test_clear() {
     BoxController_sptr bc(new BoxController(2));
     MDBox<MDLeanEvent<2>, 2> b(bc.get());
@@ -0,0 +1,66 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+
+#include "MantidDataObjects/MortonIndex/BitInterleaving.h"
+#include "MantidDataObjects/MortonIndex/CoordinateConversion.h"
+#include <cxxtest/TestSuite.h>
+#include <limits>
+
+using namespace morton_index;
+
+class CoordinateConversionTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static CoordinateConversionTest *createSuite() {
+    return new CoordinateConversionTest();
+  }
+  static void destroySuite(CoordinateConversionTest *suite) { delete suite; }
+
+  void test_ConvertCoordinatesToIntegerRange_bounds() {
+    const float coord[2] = {-1.f, 3.f};
+    const auto res =
+        ConvertCoordinatesToIntegerRange<2, uint32_t>(bounds(), coord);
+    TS_ASSERT_EQUALS(res[0], 0);
+    TS_ASSERT_EQUALS(res[1], std::numeric_limits<uint32_t>::max());
+  }
+
+  void test_ConvertCoordinatesToIntegerRange_midpoint() {
+    const float coord[2] = {0.f, 2.f};
+    const auto res =
+        ConvertCoordinatesToIntegerRange<2, uint32_t>(bounds(), coord);
+    TS_ASSERT_EQUALS(res[0], std::numeric_limits<uint32_t>::max() / 2);
+    TS_ASSERT_EQUALS(res[1], std::numeric_limits<uint32_t>::max() / 2);
+  }
+
+  void test_ConvertCoordinatesToIntegerRange_just_below_upper_bound() {
+    const float coord[2] = {std::nextafter(1.f, 0.f), std::nextafter(3.f, 0.f)};
+    const auto res =
+        ConvertCoordinatesToIntegerRange<2, uint32_t>(bounds(), coord);
+    TS_ASSERT_LESS_THAN(std::numeric_limits<uint32_t>::max() - 1000, res[0]);
+    TS_ASSERT_LESS_THAN(std::numeric_limits<uint32_t>::max() - 1000, res[1]);
+  }
+
+  void test_ConvertCoordinatesToIntegerRange_clamps_outside_bounds() {
+    const float coord[2] = {-1.5f, 3.5f};
+    const auto res32 =
+        ConvertCoordinatesToIntegerRange<2, uint32_t>(bounds(), coord);
+    TS_ASSERT_EQUALS(res32[0], 0);
+    TS_ASSERT_EQUALS(res32[1], std::numeric_limits<uint32_t>::max());
+    const auto res64 =
+        ConvertCoordinatesToIntegerRange<2, uint64_t>(bounds(), coord);
+    TS_ASSERT_EQUALS(res64[0], 0);
+    TS_ASSERT_EQUALS(res64[1], std::numeric_limits<uint64_t>::max());
+  }
+
+private:
+  static MDSpaceBounds<2> bounds() {
+    MDSpaceBounds<2> space;
+    space << -1.f, 1.f, 1.f, 3.f;
+    return space;
+  }
+};
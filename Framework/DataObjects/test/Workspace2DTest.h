@@ -61,6 +61,32 @@ public:
     ws.swap(cloned);
   }
 
+  void testCloneSharesDataUntilModified() {
+    Workspace2D_sptr cloned(ws->clone());
+    TS_ASSERT_EQUALS(&cloned->y(1), &ws->y(1));
+    TS_ASSERT_EQUALS(&cloned->e(1), &ws->e(1));
+    cloned->mutableY(1)[0] = 42.;
+    TS_ASSERT_DIFFERS(&cloned->y(1), &ws->y(1));
+    TS_ASSERT_DIFFERS(ws->y(1)[0], 42.);
+    TS_ASSERT_EQUALS(&cloned->e(1), &ws->e(1));
+    // The spectrum numbers and detector IDs are copied too
+    TS_ASSERT_EQUALS(cloned->getSpectrum(1).getSpectrumNo(),
+                     ws->getSpectrum(1).getSpectrumNo());
+    TS_ASSERT_EQUALS(cloned->getSpectrum(1).getDetectorIDs(),
+                     ws->getSpectrum(1).getDetectorIDs());
+  }
+
+  void testInitSharesDataBetweenSpectra() {
+    auto created = boost::make_shared<Workspace2D>();
+    created->initialize(3, 4, 3);
+    TS_ASSERT_EQUALS(&created->y(0), &created->y(2));
+    TS_ASSERT_EQUALS(&created->e(0), &created->e(2));
+    created->mutableY(2)[1] = 1.;
+    TS_ASSERT_DIFFERS(&created->y(0), &created->y(2));
+    TS_ASSERT_EQUALS(created->y(0)[1], 0.);
+    TS_ASSERT_EQUALS(created->getSpectrum(2).getSpectrumNo(), 3);
+  }
+
   void testInit() {
     ws->setTitle("testInit");
     TS_ASSERT_EQUALS(ws->getNumberHistograms(), nhist);
@@ -0,0 +1,68 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidKernel/V3D.h"
+#include <cstdint>
+#include <vector>
+
+namespace Mantid {
+namespace Geometry {
+
+/** MeshBVH : Bounding volume hierarchy over the triangles of a mesh.
+
+  The tree is built with the surface area heuristic over binned triangle
+  centroids and stored as a flat array of nodes in depth-first order, so that
+  the left child of a node immediately follows it. Queries return the indexes
+  of the triangles whose bounding boxes are crossed by a ray, which is a
+  superset of the triangles hit according to
+  MeshObjectCommon::rayIntersectsTriangle.
+*/
+class MANTID_GEOMETRY_DLL MeshBVH {
+public:
+  MeshBVH(const std::vector<uint32_t> &triangles,
+          const std::vector<Kernel::V3D> &vertices);
+
+  /// Find the triangles that may be intersected by a ray
+  void candidateTriangles(const Kernel::V3D &start,
+                          const Kernel::V3D &direction,
+                          std::vector<size_t> &candidates) const;
+  /// Find the triangles that may be intersected by each ray of a batch
+  void candidateTriangles(const std::vector<Kernel::V3D> &starts,
+                          const std::vector<Kernel::V3D> &directions,
+                          std::vector<std::vector<size_t>> &candidates) const;
+
+  /// The number of nodes in the tree
+  size_t numberOfNodes() const { return m_nodes.size(); }
+
+private:
+  struct Node {
+    double min[3];
+    double max[3];
+    /// Leaf: position of the first triangle in m_order. Inner node: index of
+    /// the right child
+    uint32_t offset;
+    /// Number of triangles in a leaf, 0 for an inner node
+    uint32_t count;
+  };
+
+  uint32_t build(std::vector<uint32_t> &order, size_t first, size_t last,
+                 const std::vector<double> &boxes,
+                 const std::vector<double> &centroids);
+  bool intersectsNode(const Node &node, const Kernel::V3D &start,
+                      const Kernel::V3D &direction) const;
+
+  std::vector<Node> m_nodes;
+  /// Triangle indexes, grouped by leaf
+  std::vector<uint32_t> m_order;
+  /// Smallest ray parameter accepted by the triangle intersection test
+  double m_tMin;
+};
+
+} // namespace Geometry
+} // namespace Mantid
@@ -30,6 +30,7 @@ class V3D;
 namespace Geometry {
 class CompGrp;
 class GeometryHandler;
+class MeshBVH;
 class Track;
 class vtkGeometryCacheReader;
 class vtkGeometryCacheWriter;
@@ -88,6 +89,8 @@ public:
 
   // INTERSECTION
   int interceptSurface(Geometry::Track &) const override;
+  /// Intercept a batch of tracks with a single traversal of the triangles
+  void interceptSurfaces(std::vector<Geometry::Track> &tracks) const;
   double distance(const Track &track) const override;
 
   // Solid angle - uses triangleSolidAngle unless many (>30000) triangles
@@ -153,6 +156,18 @@ private:
       const Kernel::V3D &start, const Kernel::V3D &direction,
       std::vector<Kernel::V3D> &intersectionPoints,
       std::vector<Mantid::Geometry::TrackDirection> &entryExitFlags) const;
+  /// Get intersections with the given triangles
+  void getIntersections(
+      const Kernel::V3D &start, const Kernel::V3D &direction,
+      std::vector<size_t> &candidates,
+      std::vector<Kernel::V3D> &intersectionPoints,
+      std::vector<Mantid::Geometry::TrackDirection> &entryExitFlags) const;
+  /// Add the intersections found to a track
+  int addIntersections(Track &track,
+                       const std::vector<Kernel::V3D> &intersectionPoints,
+                       const std::vector<TrackDirection> &entryExit) const;
+  /// Get the bounding volume hierarchy, building it if needed
+  std::shared_ptr<const MeshBVH> boundingVolumeHierarchy() const;
 
   /// Get triangle
   bool getTriangle(const size_t index, Kernel::V3D &v1, Kernel::V3D &v2,
@@ -162,6 +177,8 @@ private:
 
   /// Cache for object's bounding box
   mutable BoundingBox m_boundingBox;
+  /// Bounding volume hierarchy of the triangles, built on first use
+  mutable std::shared_ptr<const MeshBVH> m_bvh;
 
   /// Tolerence distance
   const double M_TOLERANCE = 0.000001;
@@ -0,0 +1,323 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Objects/MeshBVH.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+namespace Mantid {
+namespace Geometry {
+
+namespace {
+/// Number of bins used to evaluate the surface area heuristic
+constexpr size_t NUMBER_OF_BINS = 12;
+/// Nodes with this many triangles or fewer are never split
+constexpr size_t MIN_LEAF_SIZE = 4;
+/// Nodes with more triangles than this are always split
+constexpr size_t MAX_LEAF_SIZE = 16;
+/// Padding of the boxes relative to the size of the mesh, to absorb rounding
+constexpr double RELATIVE_PADDING = 1e-9;
+/// Same tolerance factor as in MeshObjectCommon::rayIntersectsTriangle
+constexpr double TRIANGLE_EPSILON = 0.0000001;
+
+/// An axis-aligned box
+struct Box {
+  std::array<double, 3> min{{std::numeric_limits<double>::max(),
+                             std::numeric_limits<double>::max(),
+                             std::numeric_limits<double>::max()}};
+  std::array<double, 3> max{{std::numeric_limits<double>::lowest(),
+                             std::numeric_limits<double>::lowest(),
+                             std::numeric_limits<double>::lowest()}};
+
+  void grow(const double *lower, const double *upper) {
+    for (size_t d = 0; d < 3; ++d) {
+      min[d] = std::min(min[d], lower[d]);
+      max[d] = std::max(max[d], upper[d]);
+    }
+  }
+  void grow(const Box &other) { grow(other.min.data(), other.max.data()); }
+
+  double halfArea() const {
+    if (min[0] > max[0])
+      return 0.;
+    const double x = max[0] - min[0];
+    const double y = max[1] - min[1];
+    const double z = max[2] - min[2];
+    return x * y + y * z + z * x;
+  }
+};
+} // namespace
+
+/**
+ * Build the hierarchy for a mesh
+ * @param triangles :: Vertex indexes of the triangles, three per triangle
+ * @param vertices :: The vertices of the mesh
+ */
+MeshBVH::MeshBVH(const std::vector<uint32_t> &triangles,
+                 const std::vector<Kernel::V3D> &vertices)
+    : m_tMin(0.) {
+  const size_t nTriangles = triangles.size() / 3;
+  if (nTriangles == 0)
+    return;
+
+  std::vector<double> boxes(6 * nTriangles);
+  std::vector<double> centroids(3 * nTriangles);
+  double maxEpsilon = 0.;
+  Box meshBox;
+  for (size_t i = 0; i < nTriangles; ++i) {
+    const auto &v1 = vertices[triangles[3 * i]];
+    const auto &v2 = vertices[triangles[3 * i + 1]];
+    const auto &v3 = vertices[triangles[3 * i + 2]];
+    double *box = &boxes[6 * i];
+    for (size_t d = 0; d < 3; ++d) {
+      box[d] = std::min({v1[d], v2[d], v3[d]});
+      box[3 + d] = std::max({v1[d], v2[d], v3[d]});
+      centroids[3 * i + d] = 0.5 * (box[d] + box[3 + d]);
+    }
+    meshBox.grow(box, box + 3);
+    maxEpsilon = std::max(maxEpsilon, TRIANGLE_EPSILON * (v2 - v1).norm());
+  }
+
+  // Pad every triangle box so that intersection points computed with
+  // rounding errors still fall inside the boxes
+  double extent = 0.;
+  for (size_t d = 0; d < 3; ++d) {
+    extent = std::max(extent, meshBox.max[d] - meshBox.min[d]);
+  }
+  const double padding = RELATIVE_PADDING * extent +
+                         std::numeric_limits<double>::min();
+  for (size_t i = 0; i < nTriangles; ++i) {
+    for (size_t d = 0; d < 3; ++d) {
+      boxes[6 * i + d] -= padding;
+      boxes[6 * i + 3 + d] += padding;
+    }
+  }
+  m_tMin = -maxEpsilon - padding;
+
+  m_order.resize(nTriangles);
+  std::iota(m_order.begin(), m_order.end(), 0);
+  m_nodes.reserve(2 * nTriangles / MIN_LEAF_SIZE + 1);
+  build(m_order, 0, nTriangles, boxes, centroids);
+}
+
+/**
+ * Recursively build the node containing the given triangles
+ * @param order :: Triangle indexes, reordered in place
+ * @param first :: Position of the first triangle of the node in order
+ * @param last :: One past the position of the last triangle
+ * @param boxes :: Bounding box of each triangle
+ * @param centroids :: Centroid of the bounding box of each triangle
+ * @return The index of the node
+ */
+uint32_t MeshBVH::build(std::vector<uint32_t> &order, const size_t first,
+                        const size_t last, const std::vector<double> &boxes,
+                        const std::vector<double> &centroids) {
+  const auto index = static_cast<uint32_t>(m_nodes.size());
+  m_nodes.emplace_back();
+
+  Box bounds, centroidBounds;
+  for (size_t i = first; i < last; ++i) {
+    const double *box = &boxes[6 * order[i]];
+    bounds.grow(box, box + 3);
+    const double *centroid = &centroids[3 * order[i]];
+    centroidBounds.grow(centroid, centroid);
+  }
+  std::copy(bounds.min.cbegin(), bounds.min.cend(), m_nodes[index].min);
+  std::copy(bounds.max.cbegin(), bounds.max.cend(), m_nodes[index].max);
+
+  const size_t count = last - first;
+  const auto makeLeaf = [&]() {
+    m_nodes[index].offset = static_cast<uint32_t>(first);
+    m_nodes[index].count = static_cast<uint32_t>(count);
+    return index;
+  };
+  if (count <= MIN_LEAF_SIZE)
+    return makeLeaf();
+
+  // Find the cheapest split among the bin boundaries of every axis
+  double bestCost = std::numeric_limits<double>::max();
+  size_t bestAxis = 0;
+  size_t bestBin = 0;
+  for (size_t axis = 0; axis < 3; ++axis) {
+    const double lower = centroidBounds.min[axis];
+    const double width = centroidBounds.max[axis] - lower;
+    if (width <= 0.)
+      continue;
+    const double scale = static_cast<double>(NUMBER_OF_BINS) / width;
+    std::array<Box, NUMBER_OF_BINS> binBoxes;
+    std::array<size_t, NUMBER_OF_BINS> binCounts{};
+    for (size_t i = first; i < last; ++i) {
+      const auto bin = std::min(
+          NUMBER_OF_BINS - 1,
+          static_cast<size_t>((centroids[3 * order[i] + axis] - lower) * scale));
+      const double *box = &boxes[6 * order[i]];
+      binBoxes[bin].grow(box, box + 3);
+      ++binCounts[bin];
+    }
+    // Sweep from the right to get the cost of every right-hand side
+    std::array<double, NUMBER_OF_BINS> rightCosts{};
+    Box right;
+    size_t rightCount = 0;
+    for (size_t bin = NUMBER_OF_BINS - 1; bin > 0; --bin) {
+      right.grow(binBoxes[bin]);
+      rightCount += binCounts[bin];
+      rightCosts[bin] = right.halfArea() * static_cast<double>(rightCount);
+    }
+    Box left;
+    size_t leftCount = 0;
+    for (size_t bin = 1; bin < NUMBER_OF_BINS; ++bin) {
+      left.grow(binBoxes[bin - 1]);
+      leftCount += binCounts[bin - 1];
+      const double cost =
+          left.halfArea() * static_cast<double>(leftCount) + rightCosts[bin];
+      if (leftCount > 0 && leftCount < count && cost < bestCost) {
+        bestCost = cost;
+        bestAxis = axis;
+        bestBin = bin;
+      }
+    }
+  }
+
+  const double leafCost = bounds.halfArea() * static_cast<double>(count);
+  if (bestCost >= leafCost && count <= MAX_LEAF_SIZE)
+    return makeLeaf();
+
+  size_t middle = first;
+  if (bestCost < std::numeric_limits<double>::max()) {
+    const double lower = centroidBounds.min[bestAxis];
+    const double scale = static_cast<double>(NUMBER_OF_BINS) /
+                         (centroidBounds.max[bestAxis] - lower);
+    const auto split = std::partition(
+        order.begin() + first, order.begin() + last, [&](uint32_t triangle) {
+          const auto bin = std::min(
+              NUMBER_OF_BINS - 1,
+              static_cast<size_t>(
+                  (centroids[3 * triangle + bestAxis] - lower) * scale));
+          return bin < bestBin;
+        });
+    middle = static_cast<size_t>(std::distance(order.begin(), split));
+  }
+  if (middle == first || middle == last) {
+    // All the centroids coincide: split the triangles in two halves
+    middle = first + count / 2;
+  }
+
+  build(order, first, middle, boxes, centroids);
+  const uint32_t rightChild = build(order, middle, last, boxes, centroids);
+  m_nodes[index].offset = rightChild;
+  m_nodes[index].count = 0;
+  return index;
+}
+
+/**
+ * Check whether a ray crosses the box of a node
+ * @param node :: The node to test
+ * @param start :: Start point of the ray
+ * @param direction :: Direction of the ray
+ * @return true if the ray crosses the box
+ */
+bool MeshBVH::intersectsNode(const Node &node, const Kernel::V3D &start,
+                             const Kernel::V3D &direction) const {
+  double tNear = m_tMin;
+  double tFar = std::numeric_limits<double>::max();
+  for (size_t d = 0; d < 3; ++d) {
+    if (direction[d] == 0.) {
+      if (start[d] < node.min[d] || start[d] > node.max[d])
+        return false;
+      continue;
+    }
+    const double inverse = 1. / direction[d];
+    double t1 = (node.min[d] - start[d]) * inverse;
+    double t2 = (node.max[d] - start[d]) * inverse;
+    if (t1 > t2)
+      std::swap(t1, t2);
+    tNear = std::max(tNear, t1);
+    tFar = std::min(tFar, t2);
+    if (tNear > tFar)
+      return false;
+  }
+  return true;
+}
+
+/**
+ * Find the triangles whose bounding box is crossed by a ray. Any triangle hit
+ * by the ray is included, in no particular order.
+ * @param start :: Start point of the ray
+ * @param direction :: Direction of the ray
+ * @param candidates :: Output triangle indexes, appended to
+ */
+void MeshBVH::candidateTriangles(const Kernel::V3D &start,
+                                 const Kernel::V3D &direction,
+                                 std::vector<size_t> &candidates) const {
+  if (m_nodes.empty())
+    return;
+  std::vector<uint32_t> stack{0};
+  while (!stack.empty()) {
+    const auto &node = m_nodes[stack.back()];
+    const uint32_t nodeIndex = stack.back();
+    stack.pop_back();
+    if (!intersectsNode(node, start, direction))
+      continue;
+    if (node.count > 0) {
+      candidates.insert(candidates.end(), m_order.begin() + node.offset,
+                        m_order.begin() + node.offset + node.count);
+    } else {
+      stack.emplace_back(node.offset);
+      stack.emplace_back(nodeIndex + 1);
+    }
+  }
+}
+
+/**
+ * Find the triangles whose bounding box is crossed by each ray of a batch.
+ * The tree is traversed once for the whole batch, each node being tested
+ * only against the rays that crossed its parent.
+ * @param starts :: Start point of each ray
+ * @param directions :: Direction of each ray
+ * @param candidates :: Output triangle indexes for each ray
+ */
+void MeshBVH::candidateTriangles(
+    const std::vector<Kernel::V3D> &starts,
+    const std::vector<Kernel::V3D> &directions,
+    std::vector<std::vector<size_t>> &candidates) const {
+  candidates.assign(starts.size(), std::vector<size_t>());
+  if (m_nodes.empty() || starts.empty())
+    return;
+  std::vector<size_t> allRays(starts.size());
+  std::iota(allRays.begin(), allRays.end(), 0);
+  std::vector<std::pair<uint32_t, std::vector<size_t>>> stack;
+  stack.emplace_back(0, std::move(allRays));
+  while (!stack.empty()) {
+    auto entry = std::move(stack.back());
+    stack.pop_back();
+    const auto &node = m_nodes[entry.first];
+    std::vector<size_t> active;
+    active.reserve(entry.second.size());
+    for (const auto ray : entry.second) {
+      if (intersectsNode(node, starts[ray], directions[ray]))
+        active.emplace_back(ray);
+    }
+    if (active.empty())
+      continue;
+    if (node.count > 0) {
+      for (const auto ray : active) {
+        candidates[ray].insert(candidates[ray].end(),
+                               m_order.begin() + node.offset,
+                               m_order.begin() + node.offset + node.count);
+      }
+    } else {
+      stack.emplace_back(node.offset, active);
+      stack.emplace_back(entry.first + 1, std::move(active));
+    }
+  }
+}
+
+} // namespace Geometry
+} // namespace Mantid
@@ -5,6 +5,7 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidGeometry/Objects/MeshObject.h"
+#include "MantidGeometry/Objects/MeshBVH.h"
 #include "MantidGeometry/Objects/MeshObjectCommon.h"
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidGeometry/RandomPoint.h"
@@ -16,6 +17,8 @@
 
 #include <boost/make_shared.hpp>
 
+#include <algorithm>
+
 namespace Mantid {
 namespace Geometry {
 
@@ -125,11 +128,18 @@ bool MeshObject::isOnSide(const Kernel::V3D &point) const {
       Kernel::V3D{1, 0, 0}}; // directions to look for intersections
   // We have to look in several directions in case a point is on a face
   // or edge parallel to the first direction or also the second direction.
-  for (const auto &direction : directions) {
+  // The candidate triangles for all directions come from a single traversal
+  // of the bounding volume hierarchy.
+  const std::vector<Kernel::V3D> starts(directions.size(), point);
+  std::vector<std::vector<size_t>> candidates;
+  boundingVolumeHierarchy()->candidateTriangles(starts, directions,
+                                                candidates);
+  for (size_t i = 0; i < directions.size(); ++i) {
     std::vector<Kernel::V3D> intersectionPoints;
     std::vector<TrackDirection> entryExitFlags;
 
-    getIntersections(point, direction, intersectionPoints, entryExitFlags);
+    getIntersections(point, directions[i], candidates[i], intersectionPoints,
+                     entryExitFlags);
 
     if (intersectionPoints.empty()) {
       return false;
@@ -161,16 +171,62 @@ int MeshObject::interceptSurface(Geometry::Track &UT) const {
 
   getIntersections(UT.startPoint(), UT.direction(), intersectionPoints,
                    entryExit);
+  return addIntersections(UT, intersectionPoints, entryExit) - originalCount;
+}
+
+/**
+ * Fill each track of a batch with its valid sections. The rays are traversed
+ * through the bounding volume hierarchy together, which is cheaper than
+ * calling interceptSurface on each track in turn.
+ * @param tracks :: Initial tracks
+ */
+void MeshObject::interceptSurfaces(std::vector<Geometry::Track> &tracks) const {
+  const BoundingBox &bb = getBoundingBox();
+  std::vector<size_t> trackIndexes;
+  std::vector<Kernel::V3D> starts, directions;
+  for (size_t i = 0; i < tracks.size(); ++i) {
+    if (bb.doesLineIntersect(tracks[i])) {
+      trackIndexes.emplace_back(i);
+      starts.emplace_back(tracks[i].startPoint());
+      directions.emplace_back(tracks[i].direction());
+    }
+  }
+  if (trackIndexes.empty())
+    return;
+
+  std::vector<std::vector<size_t>> candidates;
+  boundingVolumeHierarchy()->candidateTriangles(starts, directions,
+                                                candidates);
+  std::vector<Kernel::V3D> intersectionPoints;
+  std::vector<TrackDirection> entryExit;
+  for (size_t i = 0; i < trackIndexes.size(); ++i) {
+    intersectionPoints.clear();
+    entryExit.clear();
+    getIntersections(starts[i], directions[i], candidates[i],
+                     intersectionPoints, entryExit);
+    addIntersections(tracks[trackIndexes[i]], intersectionPoints, entryExit);
+  }
+}
+
+/**
+ * Add intersection points to a track and rebuild its links
+ * @param track :: The track to fill
+ * @param intersectionPoints :: Intersection points on the track
+ * @param entryExit :: Whether the track enters or leaves at each point
+ * @return The number of links in the track
+ */
+int MeshObject::addIntersections(
+    Track &track, const std::vector<Kernel::V3D> &intersectionPoints,
+    const std::vector<TrackDirection> &entryExit) const {
   if (intersectionPoints.empty())
-    return 0; // Quit if no intersections found
+    return track.count(); // Quit if no intersections found
 
   // For a 3D mesh, a ray may intersect several segments
   for (size_t i = 0; i < intersectionPoints.size(); ++i) {
-    UT.addPoint(entryExit[i], intersectionPoints[i], *this);
+    track.addPoint(entryExit[i], intersectionPoints[i], *this);
   }
-  UT.buildLink();
-
-  return UT.count() - originalCount;
+  track.buildLink();
+  return track.count();
 }
 
 /**
@@ -180,9 +236,15 @@ int MeshObject::interceptSurface(Geometry::Track &UT) const {
  * @throws std::runtime_error if no intersection was found
  */
 double MeshObject::distance(const Track &track) const {
+  std::vector<size_t> candidates;
+  boundingVolumeHierarchy()->candidateTriangles(
+      track.startPoint(), track.direction(), candidates);
+  // Test in triangle order to return the same point as a scan of all triangles
+  std::sort(candidates.begin(), candidates.end());
   Kernel::V3D vertex1, vertex2, vertex3, intersection;
   TrackDirection unused;
-  for (size_t i = 0; getTriangle(i, vertex1, vertex2, vertex3); ++i) {
+  for (const auto i : candidates) {
+    getTriangle(i, vertex1, vertex2, vertex3);
     if (MeshObjectCommon::rayIntersectsTriangle(
             track.startPoint(), track.direction(), vertex1, vertex2, vertex3,
             intersection, unused)) {
@@ -207,9 +269,34 @@ void MeshObject::getIntersections(
     std::vector<Kernel::V3D> &intersectionPoints,
     std::vector<TrackDirection> &entryExitFlags) const {
 
+  std::vector<size_t> candidates;
+  boundingVolumeHierarchy()->candidateTriangles(start, direction, candidates);
+  getIntersections(start, direction, candidates, intersectionPoints,
+                   entryExitFlags);
+}
+
+/**
+ * Get intersection points and their in out directions on the given ray,
+ * considering only the given triangles
+ * @param start :: Start point of ray
+ * @param direction :: Direction of ray
+ * @param candidates :: Indexes of the triangles to test, sorted in place
+ * @param intersectionPoints :: Intersection points (not sorted)
+ * @param entryExitFlags :: +1 ray enters -1 ray exits at corresponding point
+ */
+void MeshObject::getIntersections(
+    const Kernel::V3D &start, const Kernel::V3D &direction,
+    std::vector<size_t> &candidates,
+    std::vector<Kernel::V3D> &intersectionPoints,
+    std::vector<TrackDirection> &entryExitFlags) const {
+
+  // Test in triangle order so the points come out as for a scan of all
+  // triangles
+  std::sort(candidates.begin(), candidates.end());
   Kernel::V3D vertex1, vertex2, vertex3, intersection;
   TrackDirection entryExit;
-  for (size_t i = 0; getTriangle(i, vertex1, vertex2, vertex3); ++i) {
+  for (const auto i : candidates) {
+    getTriangle(i, vertex1, vertex2, vertex3);
     if (MeshObjectCommon::rayIntersectsTriangle(start, direction, vertex1,
                                                 vertex2, vertex3, intersection,
                                                 entryExit)) {
@@ -220,6 +307,22 @@ void MeshObject::getIntersections(
   // still need to deal with edge cases
 }
 
+/**
+ * The bounding volume hierarchy is built on first use. Concurrent first
+ * callers may each build one, but they all end up using the same tree.
+ * @return The bounding volume hierarchy of the triangles
+ */
+std::shared_ptr<const MeshBVH> MeshObject::boundingVolumeHierarchy() const {
+  auto bvh = std::atomic_load(&m_bvh);
+  if (!bvh) {
+    std::shared_ptr<const MeshBVH> built =
+        std::make_shared<const MeshBVH>(m_triangles, m_vertices);
+    if (std::atomic_compare_exchange_strong(&m_bvh, &bvh, built))
+      bvh = std::move(built);
+  }
+  return bvh;
+}
+
 /*
  * Get a triangle - useful for iterating over triangles
  * @param index :: Index of triangle in MeshObject
@@ -495,12 +598,14 @@ void MeshObject::rotate(const Kernel::Matrix<double> &rotationMatrix) {
   for (Kernel::V3D &vertex : m_vertices) {
     vertex.rotate(rotationMatrix);
   }
+  m_bvh.reset();
 }
 
 void MeshObject::translate(const Kernel::V3D &translationVector) {
   for (Kernel::V3D &vertex : m_vertices) {
     vertex += translationVector;
   }
+  m_bvh.reset();
 }
 
 /**
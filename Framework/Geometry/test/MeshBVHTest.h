@@ -0,0 +1,147 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidGeometry/Objects/MeshBVH.h"
+#include "MantidGeometry/Objects/MeshObjectCommon.h"
+#include "MantidKernel/MersenneTwister.h"
+#include "MantidKernel/V3D.h"
+
+#include <algorithm>
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::MersenneTwister;
+using Mantid::Kernel::V3D;
+
+class MeshBVHTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MeshBVHTest *createSuite() { return new MeshBVHTest(); }
+  static void destroySuite(MeshBVHTest *suite) { delete suite; }
+
+  void test_empty_mesh_has_no_candidates() {
+    const MeshBVH bvh({}, {});
+    std::vector<size_t> candidates;
+    bvh.candidateTriangles(V3D(0, 0, 0), V3D(1, 0, 0), candidates);
+    TS_ASSERT(candidates.empty())
+    TS_ASSERT_EQUALS(bvh.numberOfNodes(), 0)
+  }
+
+  void test_candidates_contain_every_intersected_triangle() {
+    std::vector<uint32_t> triangles;
+    std::vector<V3D> vertices;
+    createTriangleSoup(2000, triangles, vertices);
+    const MeshBVH bvh(triangles, vertices);
+    TS_ASSERT(bvh.numberOfNodes() > 1)
+
+    std::vector<V3D> starts, directions;
+    createRays(500, starts, directions);
+    size_t hits(0), candidatesCount(0);
+    for (size_t ray = 0; ray < starts.size(); ++ray) {
+      std::vector<size_t> candidates;
+      bvh.candidateTriangles(starts[ray], directions[ray], candidates);
+      std::sort(candidates.begin(), candidates.end());
+      candidatesCount += candidates.size();
+      const auto expected = intersectedTriangles(
+          starts[ray], directions[ray], triangles, vertices);
+      hits += expected.size();
+      TS_ASSERT(std::includes(candidates.cbegin(), candidates.cend(),
+                              expected.cbegin(), expected.cend()))
+    }
+    TS_ASSERT(hits > 0)
+    // The hierarchy should discard most of the triangles
+    TS_ASSERT(candidatesCount < starts.size() * triangles.size() / 30)
+  }
+
+  void test_batch_query_matches_single_ray_queries() {
+    std::vector<uint32_t> triangles;
+    std::vector<V3D> vertices;
+    createTriangleSoup(500, triangles, vertices);
+    const MeshBVH bvh(triangles, vertices);
+
+    std::vector<V3D> starts, directions;
+    createRays(100, starts, directions);
+    std::vector<std::vector<size_t>> batchCandidates;
+    bvh.candidateTriangles(starts, directions, batchCandidates);
+    TS_ASSERT_EQUALS(batchCandidates.size(), starts.size())
+    for (size_t ray = 0; ray < starts.size(); ++ray) {
+      std::vector<size_t> candidates;
+      bvh.candidateTriangles(starts[ray], directions[ray], candidates);
+      std::sort(candidates.begin(), candidates.end());
+      std::sort(batchCandidates[ray].begin(), batchCandidates[ray].end());
+      TS_ASSERT_EQUALS(candidates, batchCandidates[ray])
+    }
+  }
+
+  void test_ray_along_axis_hits_coplanar_triangles() {
+    // Identical triangles in the z = 0 plane cannot be split by centroid
+    std::vector<uint32_t> triangles;
+    const std::vector<V3D> vertices{V3D(0, 0, 0), V3D(1, 0, 0), V3D(0, 1, 0)};
+    for (uint32_t i = 0; i < 20; ++i) {
+      triangles.insert(triangles.end(), {0, 1, 2});
+    }
+    const MeshBVH bvh(triangles, vertices);
+    std::vector<size_t> candidates;
+    bvh.candidateTriangles(V3D(0.2, 0.2, -1), V3D(0, 0, 1), candidates);
+    TS_ASSERT_EQUALS(candidates.size(), 20)
+    candidates.clear();
+    bvh.candidateTriangles(V3D(2, 2, -1), V3D(0, 0, 1), candidates);
+    TS_ASSERT(candidates.empty())
+  }
+
+private:
+  void createTriangleSoup(const size_t count, std::vector<uint32_t> &triangles,
+                          std::vector<V3D> &vertices) {
+    MersenneTwister rng(1234);
+    for (size_t i = 0; i < count; ++i) {
+      const V3D centre(rng.nextValue(-10., 10.), rng.nextValue(-10., 10.),
+                       rng.nextValue(-10., 10.));
+      for (uint32_t j = 0; j < 3; ++j) {
+        triangles.emplace_back(static_cast<uint32_t>(vertices.size()));
+        vertices.emplace_back(centre + V3D(rng.nextValue(-1., 1.),
+                                           rng.nextValue(-1., 1.),
+                                           rng.nextValue(-1., 1.)));
+      }
+    }
+  }
+
+  void createRays(const size_t count, std::vector<V3D> &starts,
+                  std::vector<V3D> &directions) {
+    MersenneTwister rng(5678);
+    for (size_t i = 0; i < count; ++i) {
+      starts.emplace_back(rng.nextValue(-12., 12.), rng.nextValue(-12., 12.),
+                          rng.nextValue(-12., 12.));
+      V3D direction(rng.nextValue(-1., 1.), rng.nextValue(-1., 1.),
+                    rng.nextValue(-1., 1.));
+      // Include rays parallel to the axes
+      if (i % 5 == 0)
+        direction = V3D(0, 0, 1);
+      direction.normalize();
+      directions.emplace_back(direction);
+    }
+  }
+
+  std::vector<size_t>
+  intersectedTriangles(const V3D &start, const V3D &direction,
+                       const std::vector<uint32_t> &triangles,
+                       const std::vector<V3D> &vertices) {
+    std::vector<size_t> hits;
+    V3D intersection;
+    TrackDirection entryExit;
+    for (size_t i = 0; i < triangles.size() / 3; ++i) {
+      if (MeshObjectCommon::rayIntersectsTriangle(
+              start, direction, vertices[triangles[3 * i]],
+              vertices[triangles[3 * i + 1]], vertices[triangles[3 * i + 2]],
+              intersection, entryExit))
+        hits.emplace_back(i);
+    }
+    return hits;
+  }
+};
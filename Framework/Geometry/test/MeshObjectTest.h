@@ -385,6 +385,29 @@ public:
     checkTrackIntercept(std::move(geom_obj), track, expectedResults);
   }
 
+  void testInterceptSurfacesMatchesInterceptSurface() {
+    auto geom_obj = createOctahedron();
+    std::vector<Track> tracks;
+    tracks.emplace_back(V3D(-10, 0, 0), V3D(1, 0, 0));
+    tracks.emplace_back(V3D(-10, 0.5, 0.2), V3D(1, 0, 0));
+    tracks.emplace_back(V3D(0, 0, -10), V3D(0, 0, 1));
+    tracks.emplace_back(V3D(-10, 5, 0), V3D(1, 0, 0));
+    std::vector<Track> expectedTracks(tracks);
+    geom_obj->interceptSurfaces(tracks);
+    for (size_t i = 0; i < tracks.size(); ++i) {
+      geom_obj->interceptSurface(expectedTracks[i]);
+      TS_ASSERT_EQUALS(tracks[i].count(), expectedTracks[i].count());
+      auto expected = expectedTracks[i].cbegin();
+      for (const auto &link : tracks[i]) {
+        TS_ASSERT_DELTA(link.distFromStart, expected->distFromStart, 1e-6);
+        TS_ASSERT_EQUALS(link.entryPoint, expected->entryPoint);
+        TS_ASSERT_EQUALS(link.exitPoint, expected->exitPoint);
+        ++expected;
+      }
+    }
+    TS_ASSERT_EQUALS(tracks.back().count(), 0);
+  }
+
   void testDistanceWithIntersectionReturnsResult() {
     auto geom_obj = createCube(3);
     V3D dir(0., 1., 0.);
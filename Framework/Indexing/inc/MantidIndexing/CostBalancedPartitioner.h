@@ -0,0 +1,46 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidIndexing/DllConfig.h"
+#include "MantidIndexing/Partitioner.h"
+
+namespace Mantid {
+namespace Indexing {
+
+/** A partitioning pattern that balances the total cost of the partitions, e.g.,
+  the number of events, rather than the number of indices. The cost of each
+  index is given on construction, for example the event counts of a spectrum
+  obtained from a file or a previous run.
+
+  Indices are assigned in order of decreasing cost, each to the partition with
+  the smallest total cost so far. The assignment is deterministic, such that
+  all partitions obtain the same result given the same costs.
+
+  Monitors are not part of the balancing, their cost is added to the partitions
+  holding them as given by the MonitorStrategy.
+*/
+class MANTID_INDEXING_DLL CostBalancedPartitioner : public Partitioner {
+public:
+  CostBalancedPartitioner(const int numberOfPartitions,
+                          const PartitionIndex partition,
+                          const MonitorStrategy monitorStrategy,
+                          std::vector<GlobalSpectrumIndex> monitors,
+                          const std::vector<double> &costs);
+
+  double cost(const PartitionIndex index) const;
+  double maxCost() const;
+
+private:
+  PartitionIndex doIndexOf(const GlobalSpectrumIndex index) const override;
+
+  std::vector<int> m_partitionOf;
+  std::vector<double> m_costs;
+};
+
+} // namespace Indexing
+} // namespace Mantid
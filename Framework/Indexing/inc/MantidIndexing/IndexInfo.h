@@ -7,11 +7,13 @@
 #pragma once
 
 #include "MantidIndexing/DllConfig.h"
+#include "MantidIndexing/PartitionIndex.h"
 #include "MantidIndexing/SpectrumNumber.h"
 #include "MantidKernel/cow_ptr.h"
 #include "MantidParallel/StorageMode.h"
 
 #include <functional>
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -67,6 +69,10 @@ public:
   IndexInfo(std::vector<SpectrumNumber> spectrumNumbers,
             const Parallel::StorageMode storageMode,
             const Parallel::Communicator &communicator);
+  IndexInfo(std::vector<SpectrumNumber> spectrumNumbers,
+            const Parallel::StorageMode storageMode,
+            const Parallel::Communicator &communicator,
+            std::vector<double> spectrumCosts);
   template <class IndexType>
   IndexInfo(std::vector<IndexType> indices, const IndexInfo &parent);
 
@@ -105,6 +111,8 @@ public:
       const std::vector<size_t> &detectorIndices) const;
 
   bool isOnThisPartition(GlobalSpectrumIndex globalIndex) const;
+  PartitionIndex partitionOf(GlobalSpectrumIndex globalIndex) const;
+  std::vector<double> partitionCosts() const;
 
   Parallel::StorageMode storageMode() const;
   const Parallel::Communicator &communicator() const;
@@ -118,6 +126,8 @@ private:
 
   Kernel::cow_ptr<std::vector<SpectrumDefinition>> m_spectrumDefinitions{
       nullptr};
+  /// Optional cost of each global index, balanced across partitions.
+  std::shared_ptr<const std::vector<double>> m_spectrumCosts;
   mutable Kernel::cow_ptr<SpectrumNumberTranslator> m_spectrumNumberTranslator{
       nullptr};
 };
@@ -58,6 +58,7 @@ private:
   const int m_partitions;
   const PartitionIndex m_partition;
   const MonitorStrategy m_monitorStrategy;
+  /// Sorted, such that isMonitor is a binary search.
   const std::vector<GlobalSpectrumIndex> m_monitors;
 };
 
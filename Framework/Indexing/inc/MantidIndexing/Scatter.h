@@ -8,6 +8,8 @@
 
 #include "MantidIndexing/DllConfig.h"
 
+#include <vector>
+
 namespace Mantid {
 namespace Indexing {
 class IndexInfo;
@@ -19,6 +21,8 @@ class IndexInfo;
   @date 2017
 */
 MANTID_INDEXING_DLL IndexInfo scatter(const IndexInfo &indexInfo);
+MANTID_INDEXING_DLL IndexInfo scatter(const IndexInfo &indexInfo,
+                                      std::vector<double> spectrumCosts);
 
 } // namespace Indexing
 } // namespace Mantid
@@ -0,0 +1,98 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidIndexing/CostBalancedPartitioner.h"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+
+namespace Mantid {
+namespace Indexing {
+
+/** Constructor.
+ *
+ * @param numberOfPartitions total number of partitions
+ * @param partition the partition of the caller, used for cloned monitors
+ * @param monitorStrategy how monitors are assigned to partitions
+ * @param monitors global indices of the monitors
+ * @param costs the cost of each global spectrum index, e.g., its event count
+ */
+CostBalancedPartitioner::CostBalancedPartitioner(
+    const int numberOfPartitions, const PartitionIndex partition,
+    const MonitorStrategy monitorStrategy,
+    std::vector<GlobalSpectrumIndex> monitors, const std::vector<double> &costs)
+    : Partitioner(numberOfPartitions, partition, monitorStrategy,
+                  std::move(monitors)),
+      m_partitionOf(costs.size()), m_costs(numberOfPartitions, 0.0) {
+  if (std::any_of(costs.begin(), costs.end(),
+                  [](const double cost) { return !(cost >= 0.0); }))
+    throw std::invalid_argument(
+        "CostBalancedPartitioner: costs must not be negative.");
+
+  std::vector<size_t> order;
+  order.reserve(costs.size());
+  for (size_t i = 0; i < costs.size(); ++i) {
+    const GlobalSpectrumIndex index(i);
+    if (!isMonitor(index)) {
+      order.emplace_back(i);
+      continue;
+    }
+    const auto monitorPartition = static_cast<int>(indexOf(index));
+    m_partitionOf[i] = monitorPartition;
+    if (monitorStrategy == MonitorStrategy::CloneOnEachPartition) {
+      for (auto &cost : m_costs)
+        cost += costs[i];
+    } else {
+      m_costs[monitorPartition] += costs[i];
+    }
+  }
+  // Stable sort so that indices of equal cost keep their order and the result
+  // does not depend on the sort implementation.
+  std::stable_sort(order.begin(), order.end(), [&costs](size_t a, size_t b) {
+    return costs[a] > costs[b];
+  });
+
+  // Min-heap of (cost, partition), ties go to the lower partition index.
+  using Load = std::pair<double, int>;
+  std::priority_queue<Load, std::vector<Load>, std::greater<Load>> loads;
+  for (int i = 0; i < numberOfNonMonitorPartitions(); ++i)
+    loads.emplace(m_costs[i], i);
+  for (const auto i : order) {
+    auto load = loads.top();
+    loads.pop();
+    m_partitionOf[i] = load.second;
+    load.first += costs[i];
+    m_costs[load.second] = load.first;
+    loads.push(load);
+  }
+}
+
+/// Returns the total cost of all indices in the given partition.
+double CostBalancedPartitioner::cost(const PartitionIndex index) const {
+  checkValid(index);
+  return m_costs[static_cast<int>(index)];
+}
+
+/// Returns the largest total cost of any partition, which typically limits the
+/// overall run time of a distributed computation.
+double CostBalancedPartitioner::maxCost() const {
+  return *std::max_element(m_costs.begin(), m_costs.end());
+}
+
+PartitionIndex
+CostBalancedPartitioner::doIndexOf(const GlobalSpectrumIndex index) const {
+  const auto i = static_cast<size_t>(index);
+  if (i >= m_partitionOf.size())
+    throw std::out_of_range(
+        "CostBalancedPartitioner: no cost given for GlobalSpectrumIndex.");
+  return PartitionIndex(m_partitionOf[i]);
+}
+
+} // namespace Indexing
+} // namespace Mantid
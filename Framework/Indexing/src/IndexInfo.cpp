@@ -5,6 +5,7 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidIndexing/IndexInfo.h"
+#include "MantidIndexing/CostBalancedPartitioner.h"
 #include "MantidIndexing/RoundRobinPartitioner.h"
 #include "MantidIndexing/SpectrumNumberTranslator.h"
 #include "MantidKernel/make_cow.h"
@@ -56,6 +57,26 @@ IndexInfo::IndexInfo(std::vector<SpectrumNumber> spectrumNumbers,
   makeSpectrumNumberTranslator(std::move(spectrumNumbers));
 }
 
+/** Construct with given spectrum number and cost for each index and no
+ * spectrum definitions.
+ *
+ * In storage mode `Distributed` the spectra are partitioned such that the total
+ * cost of each partition is balanced (see CostBalancedPartitioner), rather than
+ * the number of spectra. The cost would typically be the number of events. */
+IndexInfo::IndexInfo(std::vector<SpectrumNumber> spectrumNumbers,
+                     const Parallel::StorageMode storageMode,
+                     const Parallel::Communicator &communicator,
+                     std::vector<double> spectrumCosts)
+    : m_storageMode(storageMode),
+      m_communicator(std::make_unique<Parallel::Communicator>(communicator)),
+      m_spectrumCosts(std::make_shared<const std::vector<double>>(
+          std::move(spectrumCosts))) {
+  if (m_spectrumCosts->size() != spectrumNumbers.size())
+    throw std::runtime_error("IndexInfo: Size mismatch. The vector of costs "
+                             "must contain a cost for each spectrum.");
+  makeSpectrumNumberTranslator(std::move(spectrumNumbers));
+}
+
 /** Construct with given index subset of parent.
  *
  * The template argument IndexType can be SpectrumNumber or GlobalSpectrumIndex.
@@ -90,6 +111,7 @@ IndexInfo::IndexInfo(const IndexInfo &other)
       m_communicator(
           std::make_unique<Parallel::Communicator>(*other.m_communicator)),
       m_spectrumDefinitions(other.m_spectrumDefinitions),
+      m_spectrumCosts(other.m_spectrumCosts),
       m_spectrumNumberTranslator(other.m_spectrumNumberTranslator) {}
 
 IndexInfo::IndexInfo(IndexInfo &&) noexcept = default;
@@ -380,6 +402,28 @@ bool IndexInfo::isOnThisPartition(GlobalSpectrumIndex globalIndex) const {
   return helperSet.size() == 1;
 }
 
+/// Returns the partition (MPI rank) holding the given global index.
+PartitionIndex IndexInfo::partitionOf(GlobalSpectrumIndex globalIndex) const {
+  return m_spectrumNumberTranslator->partitionOf(globalIndex);
+}
+
+/** Returns the total cost of the spectra on each partition.
+ *
+ * If no costs were given on construction every spectrum has unit cost, i.e.,
+ * the result is the number of spectra on each partition. */
+std::vector<double> IndexInfo::partitionCosts() const {
+  const auto partitions = m_storageMode == Parallel::StorageMode::Distributed
+                              ? m_communicator->size()
+                              : 1;
+  std::vector<double> costs(partitions, 0.0);
+  for (size_t i = 0; i < globalSize(); ++i) {
+    const auto partition =
+        static_cast<int>(partitionOf(GlobalSpectrumIndex(i)));
+    costs[partition] += m_spectrumCosts ? (*m_spectrumCosts)[i] : 1.0;
+  }
+  return costs;
+}
+
 /// Returns the storage mode used in MPI runs.
 Parallel::StorageMode IndexInfo::storageMode() const { return m_storageMode; }
 
@@ -409,9 +453,16 @@ void IndexInfo::makeSpectrumNumberTranslator(
     throw std::runtime_error("IndexInfo: unknown storage mode " +
                              Parallel::toString(m_storageMode));
   }
-  auto partitioner = std::make_unique<RoundRobinPartitioner>(
-      numberOfPartitions, partition,
-      Partitioner::MonitorStrategy::TreatAsNormalSpectrum);
+  std::unique_ptr<Partitioner> partitioner;
+  if (m_spectrumCosts && m_spectrumCosts->size() == spectrumNumbers.size())
+    partitioner = std::make_unique<CostBalancedPartitioner>(
+        numberOfPartitions, partition,
+        Partitioner::MonitorStrategy::TreatAsNormalSpectrum,
+        std::vector<GlobalSpectrumIndex>{}, *m_spectrumCosts);
+  else
+    partitioner = std::make_unique<RoundRobinPartitioner>(
+        numberOfPartitions, partition,
+        Partitioner::MonitorStrategy::TreatAsNormalSpectrum);
   m_spectrumNumberTranslator = Kernel::make_cow<SpectrumNumberTranslator>(
       std::move(spectrumNumbers), *partitioner, partition);
 }
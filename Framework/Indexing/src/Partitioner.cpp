@@ -12,12 +12,21 @@
 namespace Mantid {
 namespace Indexing {
 
+namespace {
+std::vector<GlobalSpectrumIndex>
+sorted(std::vector<GlobalSpectrumIndex> &&indices) {
+  std::sort(indices.begin(), indices.end());
+  return std::move(indices);
+}
+} // namespace
+
 Partitioner::Partitioner(const int numberOfPartitions,
                          const PartitionIndex partition,
                          const MonitorStrategy monitorStrategy,
                          std::vector<GlobalSpectrumIndex> monitors)
     : m_partitions(numberOfPartitions), m_partition(partition),
-      m_monitorStrategy(monitorStrategy), m_monitors(std::move(monitors)) {
+      m_monitorStrategy(monitorStrategy),
+      m_monitors(sorted(std::move(monitors))) {
   if (numberOfNonMonitorPartitions() < 1)
     throw std::logic_error("Partitioner: Number of non-monitor partitions "
                            "must be larger than 0.");
@@ -53,8 +62,7 @@ void Partitioner::checkValid(const PartitionIndex index) const {
 bool Partitioner::isMonitor(const GlobalSpectrumIndex index) const {
   if (m_monitorStrategy == MonitorStrategy::TreatAsNormalSpectrum)
     return false;
-  return std::find(m_monitors.begin(), m_monitors.end(), index) !=
-         m_monitors.end();
+  return std::binary_search(m_monitors.begin(), m_monitors.end(), index);
 }
 
 } // namespace Indexing
@@ -14,8 +14,9 @@
 namespace Mantid {
 namespace Indexing {
 
-/// Returns a scattered copy of `indexInfo` with storage mode `Distributed`.
-IndexInfo scatter(const Indexing::IndexInfo &indexInfo) {
+namespace {
+IndexInfo doScatter(const Indexing::IndexInfo &indexInfo,
+                    std::vector<double> *spectrumCosts) {
   using namespace Parallel;
   if (indexInfo.communicator().size() == 1 ||
       indexInfo.storageMode() == Parallel::StorageMode::Distributed)
@@ -28,7 +29,11 @@ IndexInfo scatter(const Indexing::IndexInfo &indexInfo) {
   std::vector<SpectrumNumber> spectrumNumbers;
   for (size_t i = 0; i < indexInfo.size(); ++i)
     spectrumNumbers.emplace_back(indexInfo.spectrumNumber(i));
-  IndexInfo scattered(spectrumNumbers, Parallel::StorageMode::Distributed,
+  IndexInfo scattered =
+      spectrumCosts
+          ? IndexInfo(spectrumNumbers, Parallel::StorageMode::Distributed,
+                      indexInfo.communicator(), std::move(*spectrumCosts))
+          : IndexInfo(spectrumNumbers, Parallel::StorageMode::Distributed,
                       indexInfo.communicator());
   const auto &globalSpectrumDefinitions = indexInfo.spectrumDefinitions();
   std::vector<SpectrumDefinition> spectrumDefinitions;
@@ -38,6 +43,21 @@ IndexInfo scatter(const Indexing::IndexInfo &indexInfo) {
   scattered.setSpectrumDefinitions(spectrumDefinitions);
   return scattered;
 }
+} // namespace
+
+/// Returns a scattered copy of `indexInfo` with storage mode `Distributed`.
+IndexInfo scatter(const Indexing::IndexInfo &indexInfo) {
+  return doScatter(indexInfo, nullptr);
+}
+
+/** Returns a scattered copy of `indexInfo` with storage mode `Distributed`,
+ * partitioned such that the given per-spectrum costs (e.g., event counts) are
+ * balanced across partitions. `spectrumCosts` must contain a cost for each
+ * global index of `indexInfo`. */
+IndexInfo scatter(const Indexing::IndexInfo &indexInfo,
+                  std::vector<double> spectrumCosts) {
+  return doScatter(indexInfo, &spectrumCosts);
+}
 
 } // namespace Indexing
 } // namespace Mantid
@@ -0,0 +1,108 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidIndexing/CostBalancedPartitioner.h"
+
+using namespace Mantid::Indexing;
+
+class CostBalancedPartitionerTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static CostBalancedPartitionerTest *createSuite() {
+    return new CostBalancedPartitionerTest();
+  }
+  static void destroySuite(CostBalancedPartitionerTest *suite) {
+    delete suite;
+  }
+
+  void test_negative_cost_throws() {
+    const auto strategy = Partitioner::MonitorStrategy::TreatAsNormalSpectrum;
+    TS_ASSERT_THROWS(CostBalancedPartitioner(2, PartitionIndex(0), strategy,
+                                             std::vector<GlobalSpectrumIndex>{},
+                                             {1.0, -1.0}),
+                     const std::invalid_argument &);
+  }
+
+  void test_index_without_cost_throws() {
+    CostBalancedPartitioner partitioner(
+        2, PartitionIndex(0),
+        Partitioner::MonitorStrategy::TreatAsNormalSpectrum,
+        std::vector<GlobalSpectrumIndex>{}, {1.0, 1.0});
+    TS_ASSERT_THROWS(partitioner.indexOf(GlobalSpectrumIndex(2)),
+                     const std::out_of_range &);
+  }
+
+  void test_1_rank() {
+    CostBalancedPartitioner partitioner(
+        1, PartitionIndex(0),
+        Partitioner::MonitorStrategy::TreatAsNormalSpectrum,
+        std::vector<GlobalSpectrumIndex>{}, {1.0, 5.0, 2.0});
+    TS_ASSERT_EQUALS(partitioner.numberOfPartitions(), 1);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(0)), 0);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(1)), 0);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(2)), 0);
+    TS_ASSERT_EQUALS(partitioner.cost(PartitionIndex(0)), 8.0);
+  }
+
+  void test_equal_costs_fall_back_to_round_robin() {
+    CostBalancedPartitioner partitioner(
+        3, PartitionIndex(0),
+        Partitioner::MonitorStrategy::TreatAsNormalSpectrum,
+        std::vector<GlobalSpectrumIndex>{}, std::vector<double>(4, 1.0));
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(0)), 0);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(1)), 1);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(2)), 2);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(3)), 0);
+    TS_ASSERT_EQUALS(partitioner.maxCost(), 2.0);
+  }
+
+  void test_balances_costs() {
+    // Round-robin would give costs of 2000 and 3.
+    CostBalancedPartitioner partitioner(
+        2, PartitionIndex(0),
+        Partitioner::MonitorStrategy::TreatAsNormalSpectrum,
+        std::vector<GlobalSpectrumIndex>{},
+        {1000.0, 1.0, 600.0, 1.0, 400.0, 1.0});
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(0)), 0);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(2)), 1);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(4)), 1);
+    TS_ASSERT_EQUALS(partitioner.cost(PartitionIndex(0)), 1002.0);
+    TS_ASSERT_EQUALS(partitioner.cost(PartitionIndex(1)), 1001.0);
+    TS_ASSERT_EQUALS(partitioner.maxCost(), 1002.0);
+  }
+
+  void test_dedicated_monitor_partition() {
+    CostBalancedPartitioner partitioner(
+        3, PartitionIndex(0), Partitioner::MonitorStrategy::DedicatedPartition,
+        {GlobalSpectrumIndex(1)}, {3.0, 100.0, 2.0, 1.0});
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(0)), 0);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(1)), 2);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(2)), 1);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(3)), 1);
+    TS_ASSERT_EQUALS(partitioner.cost(PartitionIndex(0)), 3.0);
+    TS_ASSERT_EQUALS(partitioner.cost(PartitionIndex(1)), 3.0);
+    TS_ASSERT_EQUALS(partitioner.cost(PartitionIndex(2)), 100.0);
+  }
+
+  void test_cloned_monitor_adds_cost_to_all_partitions() {
+    CostBalancedPartitioner partitioner(
+        2, PartitionIndex(1),
+        Partitioner::MonitorStrategy::CloneOnEachPartition,
+        {GlobalSpectrumIndex(0)}, {10.0, 4.0, 3.0});
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(0)), 1);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(1)), 0);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(2)), 1);
+    TS_ASSERT_EQUALS(partitioner.cost(PartitionIndex(0)), 14.0);
+    TS_ASSERT_EQUALS(partitioner.cost(PartitionIndex(1)), 13.0);
+    TS_ASSERT_THROWS(partitioner.cost(PartitionIndex(2)),
+                     const std::out_of_range &);
+  }
+};
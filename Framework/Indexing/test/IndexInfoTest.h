@@ -8,6 +8,7 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include "MantidIndexing/CostBalancedPartitioner.h"
 #include "MantidIndexing/GlobalSpectrumIndex.h"
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/make_cow.h"
@@ -50,6 +51,35 @@ void run_StorageMode_Distributed(const Parallel::Communicator &comm) {
   TS_ASSERT_EQUALS(i.size(), expectedSize);
 }
 
+void run_StorageMode_Distributed_with_costs(
+    const Parallel::Communicator &comm) {
+  const std::vector<double> costs{40.0, 1.0, 2.0, 3.0, 20.0, 5.0, 6.0, 7.0};
+  IndexInfo i(std::vector<SpectrumNumber>{1, 2, 3, 4, 5, 6, 7, 8},
+              Parallel::StorageMode::Distributed, comm, costs);
+  const CostBalancedPartitioner partitioner(
+      comm.size(), PartitionIndex(comm.rank()),
+      Partitioner::MonitorStrategy::TreatAsNormalSpectrum, {}, costs);
+  size_t expectedSize = 0;
+  for (size_t globalIndex = 0; globalIndex < i.globalSize(); ++globalIndex) {
+    const GlobalSpectrumIndex index(globalIndex);
+    TS_ASSERT_EQUALS(i.partitionOf(index), partitioner.indexOf(index));
+    if (partitioner.indexOf(index) == PartitionIndex(comm.rank())) {
+      TS_ASSERT_EQUALS(i.spectrumNumber(expectedSize),
+                       static_cast<int>(globalIndex) + 1);
+      ++expectedSize;
+    }
+  }
+  TS_ASSERT_EQUALS(i.size(), expectedSize);
+  const auto partitionCosts = i.partitionCosts();
+  TS_ASSERT_EQUALS(partitionCosts.size(), comm.size());
+  for (int rank = 0; rank < comm.size(); ++rank)
+    TS_ASSERT_EQUALS(partitionCosts[rank],
+                     partitioner.cost(PartitionIndex(rank)));
+  // Copies keep the partitioning.
+  const auto copy(i);
+  TS_ASSERT_EQUALS(copy.partitionCosts(), partitionCosts);
+}
+
 void run_StorageMode_MasterOnly(const Parallel::Communicator &comm) {
   if (comm.rank() == 0) {
     IndexInfo i(3, Parallel::StorageMode::MasterOnly, comm);
@@ -418,6 +448,23 @@ public:
     run_StorageMode_Distributed(Parallel::Communicator{});
   }
 
+  void test_StorageMode_Distributed_with_costs() {
+    runParallel(run_StorageMode_Distributed_with_costs);
+  }
+
+  void test_costs_size_mismatch() {
+    TS_ASSERT_THROWS(IndexInfo(std::vector<SpectrumNumber>{1, 2},
+                               Parallel::StorageMode::Distributed,
+                               Parallel::Communicator{}, {1.0}),
+                     const std::runtime_error &);
+  }
+
+  void test_partitionCosts_defaults_to_number_of_spectra() {
+    IndexInfo i(3);
+    TS_ASSERT_EQUALS(i.partitionCosts(), std::vector<double>{3.0});
+    TS_ASSERT_EQUALS(i.partitionOf(GlobalSpectrumIndex(2)), PartitionIndex(0));
+  }
+
   void test_StorageMode_MasterOnly() {
     runParallel(run_StorageMode_MasterOnly);
     // Trivial: Run with one partition.
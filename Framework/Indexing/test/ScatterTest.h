@@ -8,6 +8,7 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include "MantidIndexing/GlobalSpectrumIndex.h"
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidIndexing/Scatter.h"
 #include "MantidIndexing/SpectrumIndexSet.h"
@@ -62,6 +63,33 @@ void run_StorageMode_Cloned(const Communicator &comm) {
     }
   }
 }
+
+void run_StorageMode_Cloned_with_costs(const Communicator &comm) {
+  const auto indexInfo = makeIndexInfo(comm);
+  const std::vector<double> costs{1.0, 100.0, 1.0, 1.0, 50.0, 1.0, 1.0};
+  const auto result = scatter(indexInfo, costs);
+  if (comm.size() == 1) {
+    TS_ASSERT_EQUALS(result.size(), indexInfo.size());
+    return;
+  }
+  TS_ASSERT_EQUALS(result.storageMode(), StorageMode::Distributed);
+  TS_ASSERT_EQUALS(result.globalSize(), indexInfo.size());
+  const auto resultSpecDefs = result.spectrumDefinitions();
+  const auto specDefs = indexInfo.spectrumDefinitions();
+  size_t current = 0;
+  for (size_t i = 0; i < specDefs->size(); ++i) {
+    if (result.partitionOf(GlobalSpectrumIndex(i)) == comm.rank()) {
+      TS_ASSERT_EQUALS(result.spectrumNumber(current),
+                       indexInfo.spectrumNumber(i));
+      TS_ASSERT_EQUALS(resultSpecDefs->at(current), specDefs->at(i));
+      ++current;
+    }
+  }
+  TS_ASSERT_EQUALS(result.size(), current);
+  // The two expensive spectra end up on different partitions.
+  TS_ASSERT_DIFFERS(result.partitionOf(GlobalSpectrumIndex(1)),
+                    result.partitionOf(GlobalSpectrumIndex(4)));
+}
 } // namespace
 
 class ScatterTest : public CxxTest::TestSuite {
@@ -89,4 +117,8 @@ public:
   }
 
   void test_StorageMode_Cloned() { runParallel(run_StorageMode_Cloned); }
+
+  void test_StorageMode_Cloned_with_costs() {
+    runParallel(run_StorageMode_Cloned_with_costs);
+  }
 };
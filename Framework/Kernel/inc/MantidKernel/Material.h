@@ -13,6 +13,7 @@
 #include "MantidKernel/PhysicalConstants.h"
 #include <boost/shared_ptr.hpp>
 #include <string>
+#include <utility>
 #include <vector>
 
 // Forward Declares
@@ -97,6 +98,8 @@ public:
   double
   absorbXSection(const double lambda =
                      PhysicalConstants::NeutronAtom::ReferenceLambda) const;
+  /// Coefficients (constant, slope per Angstrom) of the attenuation exponent
+  std::pair<double, double> attenuationCoefficients() const;
   /// Compute the attenuation at a given wavelegnth over the given distance
   double attenuation(const double distance,
                      const double lambda =
@@ -171,6 +171,21 @@ public:
    */
   virtual double singleFromTOF(const double tof) const = 0;
 
+  /** Convert an array of values in this unit to TOF in place. The unit must
+   * have been initialized. Concrete units override this to convert the whole
+   * array without a virtual call per value.
+   * @param first :: Pointer to the first value to convert
+   * @param last :: Pointer past the last value to convert
+   */
+  virtual void batchToTOF(double *first, double *last) const;
+
+  /** Convert an array of TOF values to this unit in place. The unit must have
+   * been initialized.
+   * @param first :: Pointer to the first value to convert
+   * @param last :: Pointer past the last value to convert
+   */
+  virtual void batchFromTOF(double *first, double *last) const;
+
   /// @return true if the unit was initialized and so can use singleToTOF()
   bool isInitialized() const { return initialized; }
 
@@ -289,6 +304,8 @@ public:
   void init() override;
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(double *first, double *last) const override;
+  void batchFromTOF(double *first, double *last) const override;
   Unit *clone() const override;
   ///@return -DBL_MAX as ToF convertible to TOF for in any time range
   double conversionTOFMin() const override;
@@ -306,6 +323,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(double *first, double *last) const override;
+  void batchFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -333,6 +352,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(double *first, double *last) const override;
+  void batchFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -357,6 +378,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(double *first, double *last) const override;
+  void batchFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -380,6 +403,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(double *first, double *last) const override;
+  void batchFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -405,6 +430,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(double *first, double *last) const override;
+  void batchFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -430,6 +457,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(double *first, double *last) const override;
+  void batchFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -452,6 +481,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(double *first, double *last) const override;
+  void batchFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -475,6 +506,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(double *first, double *last) const override;
+  void batchFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -534,6 +567,8 @@ public:
 
   double singleToTOF(const double ki) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(double *first, double *last) const override;
+  void batchFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -560,6 +595,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(double *first, double *last) const override;
+  void batchFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -579,6 +616,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(double *first, double *last) const override;
+  void batchFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -249,6 +249,18 @@ double Material::absorbXSection(const double lambda) const {
   return m_linearAbsorpXSectionByWL * lambda;
 }
 
+/**
+ * The attenuation over a distance d at wavelength lambda is
+ * exp(-(constant + slope * lambda) * d), since only the absorption cross
+ * section depends on the wavelength. This allows for combining the exponents of
+ * several distances or materials before evaluating it for many wavelengths.
+ * @return The constant (per m) and the slope (per m per Angstrom)
+ */
+std::pair<double, double> Material::attenuationCoefficients() const {
+  return {100 * numberDensity() * totalScatterXSection(),
+          100 * numberDensity() * m_linearAbsorpXSectionByWL};
+}
+
 /**
  * @param distance Distance (m) travelled
  * @param lambda Wavelength (Angstroms) to compute the attenuation (default =
@@ -256,8 +268,8 @@ double Material::absorbXSection(const double lambda) const {
  * @return The dimensionless attenuation coefficient
  */
 double Material::attenuation(const double distance, const double lambda) const {
-  return exp(-100 * numberDensity() *
-             (totalScatterXSection() + absorbXSection(lambda)) * distance);
+  const auto coefficients = attenuationCoefficients();
+  return exp(-(coefficients.first + coefficients.second * lambda) * distance);
 }
 
 // NOTE: the angstrom^-2 to barns and the angstrom^-1 to cm^-1
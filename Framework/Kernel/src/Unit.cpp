@@ -11,6 +11,7 @@
 #include "MantidKernel/PhysicalConstants.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/UnitLabelTypes.h"
+#include <algorithm>
 #include <cfloat>
 
 namespace Mantid {
@@ -138,9 +139,7 @@ void Unit::toTOF(std::vector<double> &xdata, std::vector<double> &ydata,
                  const double &_delta) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _l2, _twoTheta, _emode, _efixed, _delta);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleToTOF(xdata[i]);
+  this->batchToTOF(xdata.data(), xdata.data() + xdata.size());
 }
 
 /** Convert a single value to TOF
@@ -169,9 +168,7 @@ void Unit::fromTOF(std::vector<double> &xdata, std::vector<double> &ydata,
                    const double &_efixed, const double &_delta) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _l2, _twoTheta, _emode, _efixed, _delta);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleFromTOF(xdata[i]);
+  this->batchFromTOF(xdata.data(), xdata.data() + xdata.size());
 }
 
 /** Convert a single value from TOF
@@ -191,6 +188,16 @@ double Unit::convertSingleFromTOF(const double xvalue, const double &l1,
   return this->singleFromTOF(xvalue);
 }
 
+void Unit::batchToTOF(double *first, double *last) const {
+  for (; first != last; ++first)
+    *first = this->singleToTOF(*first);
+}
+
+void Unit::batchFromTOF(double *first, double *last) const {
+  for (; first != last; ++first)
+    *first = this->singleFromTOF(*first);
+}
+
 std::pair<double, double> Unit::conversionRange() const {
   double u1 = this->singleFromTOF(this->conversionTOFMin());
   double u2 = this->singleFromTOF(this->conversionTOFMax());
@@ -287,6 +294,14 @@ double TOF::singleFromTOF(const double tof) const {
   return tof;
 }
 
+void TOF::batchToTOF(double *, double *) const {
+  // Nothing to do
+}
+
+void TOF::batchFromTOF(double *, double *) const {
+  // Nothing to do
+}
+
 Unit *TOF::clone() const { return new TOF(*this); }
 double TOF::conversionTOFMin() const { return -DBL_MAX; }
 ///@return DBL_MAX as ToF convetanble to TOF for in any time range
@@ -1322,6 +1337,38 @@ double timeConversionValue(std::string input_unit, std::string output_unit) {
   return input_float / output_float;
 }
 
+/* =============================================================================
+ * Batch conversions
+ * =============================================================================
+ * The conversion functions are called by their qualified name so that they are
+ * not dispatched virtually and can be inlined into the loops.
+ */
+#define DEFINE_BATCH_CONVERSIONS(UnitType)                                     \
+  void UnitType::batchToTOF(double *first, double *last) const {               \
+    std::transform(first, last, first, [this](const double x) {                \
+      return UnitType::singleToTOF(x);                                         \
+    });                                                                        \
+  }                                                                            \
+  void UnitType::batchFromTOF(double *first, double *last) const {             \
+    std::transform(first, last, first, [this](const double tof) {              \
+      return UnitType::singleFromTOF(tof);                                     \
+    });                                                                        \
+  }
+
+DEFINE_BATCH_CONVERSIONS(Wavelength)
+DEFINE_BATCH_CONVERSIONS(Energy)
+DEFINE_BATCH_CONVERSIONS(Energy_inWavenumber)
+DEFINE_BATCH_CONVERSIONS(dSpacing)
+DEFINE_BATCH_CONVERSIONS(dSpacingPerpendicular)
+DEFINE_BATCH_CONVERSIONS(MomentumTransfer)
+DEFINE_BATCH_CONVERSIONS(QSquared)
+DEFINE_BATCH_CONVERSIONS(DeltaE)
+DEFINE_BATCH_CONVERSIONS(Momentum)
+DEFINE_BATCH_CONVERSIONS(SpinEchoLength)
+DEFINE_BATCH_CONVERSIONS(SpinEchoTime)
+
+#undef DEFINE_BATCH_CONVERSIONS
+
 } // namespace Units
 
 } // namespace Kernel
@@ -82,6 +82,29 @@ public:
     TS_ASSERT_DELTA(material.attenuation(distance, lambda), 0.01884, 1e-4);
   }
 
+  void test_attenuationCoefficients_match_attenuation() {
+    Material material("Vanadium", getNeutronAtom(23), 0.072);
+    const auto coefficients = material.attenuationCoefficients();
+    TS_ASSERT_DELTA(coefficients.first,
+                    100. * 0.072 * material.totalScatterXSection(), 1e-12);
+    TS_ASSERT_DELTA(coefficients.second,
+                    100. * 0.072 * material.absorbXSection(1.), 1e-12);
+    const double distance(0.05);
+    for (const double lambda : {0.5, 1.0, 1.7982, 2.1, 6.0}) {
+      const double exponent =
+          (coefficients.first + coefficients.second * lambda) * distance;
+      TS_ASSERT_DELTA(std::exp(-exponent),
+                      material.attenuation(distance, lambda), 1e-12);
+      TS_ASSERT_DELTA(
+          material.attenuation(distance, lambda),
+          std::exp(-100. * material.numberDensity() *
+                   (material.totalScatterXSection() +
+                    material.absorbXSection(lambda)) *
+                   distance),
+          1e-12);
+    }
+  }
+
   // highly absorbing material
   void test_Gadolinium() {
     const std::string name("Gadolinium");
@@ -245,6 +245,25 @@ public:
     delete unit;
   }
 
+  void test_batch_conversions_match_single_conversions() {
+    // Elastic units and the spin echo units need emode = 0
+    checkBatchConversions(tof, 0);
+    checkBatchConversions(lambda, 0);
+    checkBatchConversions(energy, 0);
+    checkBatchConversions(energyk, 0);
+    checkBatchConversions(d, 0);
+    checkBatchConversions(dp, 0);
+    checkBatchConversions(q, 0);
+    checkBatchConversions(q2, 0);
+    checkBatchConversions(k_i, 0);
+    checkBatchConversions(delta, 0);
+    checkBatchConversions(tau, 0);
+    // Energy transfer needs an inelastic mode
+    checkBatchConversions(dE, 1);
+    checkBatchConversions(dEk, 1);
+    checkBatchConversions(dEf, 2);
+  }
+
   //----------------------------------------------------------------------
   // TOF tests
   //----------------------------------------------------------------------
@@ -1517,6 +1536,23 @@ public:
   }
 
 private:
+  /// Check that converting an array gives exactly the single conversions
+  void checkBatchConversions(Unit &unit, const int emode) {
+    unit.initialize(10., 2., 1.2, emode, 50., 0.);
+    std::vector<double> tofs;
+    for (double tof = 5000.; tof < 20000.; tof += 999.)
+      tofs.emplace_back(tof);
+    auto values = tofs;
+    unit.batchFromTOF(values.data(), values.data() + values.size());
+    for (size_t i = 0; i < tofs.size(); ++i)
+      TSM_ASSERT_EQUALS(unit.unitID(), values[i], unit.singleFromTOF(tofs[i]));
+    auto converted = values;
+    unit.batchToTOF(converted.data(), converted.data() + converted.size());
+    for (size_t i = 0; i < values.size(); ++i)
+      TSM_ASSERT_EQUALS(unit.unitID(), converted[i],
+                        unit.singleToTOF(values[i]));
+  }
+
   Units::Label label;
   Units::TOF tof;
   Units::Wavelength lambda;
@@ -37,6 +37,14 @@ class ConvToMDEventsWSIndexing : public ConvToMDEventsWS {
                                const API::BoxController_sptr &bc) override;
 
 public:
+  /**
+   * @param sortEventsByMortonIndex :: if true, mark the events in each box as
+   * sorted by Morton index after the conversion, so that axis-aligned slicing
+   * can scan contiguous ranges of them
+   */
+  explicit ConvToMDEventsWSIndexing(bool sortEventsByMortonIndex = false)
+      : m_sortEventsByMortonIndex(sortEventsByMortonIndex) {}
+
   template <typename T>
   static bool isSplitValid(const std::vector<T> &split_into) {
     bool validSplitInfo = !split_into.empty();
@@ -51,6 +59,9 @@ public:
   }
 
 private:
+  // Keep the events of each box ordered by Morton index
+  bool m_sortEventsByMortonIndex;
+
   // Returns number of workers for parallel parts
   int numWorkers() {
     return this->m_NumThreads < 0 ? PARALLEL_GET_MAX_THREADS
@@ -203,6 +214,15 @@ void ConvToMDEventsWSIndexing::appendEvents(API::Progress *pProgress,
   auto rootAndErr = distributor.distribute(mdEvents);
   m_OutWSWrapper->pWorkspace()->setBox(rootAndErr.root);
   rootAndErr.root->calculateGridCaches();
+  if (m_sortEventsByMortonIndex) {
+    // The events arrive sorted by Morton index, keep them in that order within
+    // each box so that axis-aligned slicing can scan contiguous ranges
+    auto outWS = boost::dynamic_pointer_cast<
+        DataObjects::MDEventWorkspace<MDEventType<ND>, ND>>(
+        m_OutWSWrapper->pWorkspace());
+    if (outWS)
+      outWS->sortEventsByMortonIndex();
+  }
 
   std::stringstream ss;
   ss << rootAndErr.err;
@@ -28,8 +28,11 @@ public:
   /**
    *
    * @param tp :: type of converter (indexed or default)
+   * @param sortEventsByMortonIndex :: for the indexed converter, keep the
+   * events of each box ordered by Morton index
    */
-  ConvToMDSelector(ConverterType tp = DEFAULT);
+  ConvToMDSelector(ConverterType tp = DEFAULT,
+                   bool sortEventsByMortonIndex = false);
   /// function which selects the convertor depending on workspace type and
   /// (possibly, in a future) some workspace properties
   boost::shared_ptr<ConvToMDBase>
@@ -38,6 +41,7 @@ public:
 
 private:
   ConverterType converterType;
+  bool sortEventsByMortonIndex;
 };
 } // namespace MDAlgorithms
 } // namespace Mantid
@@ -7,11 +7,20 @@
 #pragma once
 
 #include "MantidAPI/Algorithm.h"
+#include "MantidAPI/MatrixWorkspace_fwd.h"
 #include "MantidGeometry/Crystal/SymmetryOperationFactory.h"
 #include "MantidMDAlgorithms/DllConfig.h"
+#include "MantidKernel/cow_ptr.h"
 #include "MantidMDAlgorithms/SlicingAlgorithm.h"
+#include "MantidTypes/SpectrumDefinition.h"
 
 namespace Mantid {
+namespace API {
+class ExperimentInfo;
+}
+namespace Geometry {
+class DetectorInfo;
+}
 namespace MDAlgorithms {
 
 /** MDNormalization : Bin single crystal diffraction or direct geometry
@@ -46,6 +55,10 @@ private:
   getValuesFromOtherDimensions(bool &skipNormalization,
                                uint16_t expInfoIndex = 0) const;
   void cacheDimensionXValues();
+  void cacheDetectorInformation(
+      const API::ExperimentInfo &exptInfo,
+      const API::MatrixWorkspace_const_sptr &solidAngleWS,
+      const API::MatrixWorkspace_const_sptr &integrFlux);
   void calculateNormalization(const std::vector<coord_t> &otherValues,
                               Geometry::SymmetryOperation so,
                               uint16_t expInfoIndex, size_t soIndex);
@@ -93,6 +106,27 @@ private:
   Kernel::V3D m_samplePos;
   /// Beam direction
   Kernel::V3D m_beamDir;
+  /// Per-spectrum quantities that depend only on the instrument
+  struct DetectorCacheEntry {
+    /// Polar angle of the detector
+    double theta = 0.;
+    /// Azimuthal angle of the detector
+    double phi = 0.;
+    /// Solid angle, without the proton charge
+    double solidAngle = 1.;
+    /// Workspace index of the detector in the flux workspace
+    size_t fluxIndex = 0;
+    /// Flag for monitors, masked detectors and detectors missing in the flux
+    bool skip = true;
+  };
+  /// Cached detector quantities, reused across experiment infos and symmetry
+  /// operations as long as the instrument is unchanged
+  std::vector<DetectorCacheEntry> m_detectorCache;
+  /// The detector info the cache was built from
+  const Geometry::DetectorInfo *m_cachedDetectorInfo = nullptr;
+  /// The spectrum definitions the cache was built from
+  Kernel::cow_ptr<std::vector<SpectrumDefinition>> m_cachedSpectrumDefinitions{
+      nullptr};
   /// ki-kf for Inelastic convention; kf-ki for Crystallography convention
   std::string convention;
 };
@@ -40,6 +40,11 @@ private:
   template <typename MDE, size_t nd>
   void doPlus(typename Mantid::DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
 
+  bool inputsShareBoxStructure() const;
+
+  template <typename MDE, size_t nd>
+  void doMergeByBox(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
+
   /// Vector of input MDWorkspaces
   std::vector<Mantid::API::IMDEventWorkspace_sptr> m_workspaces;
 
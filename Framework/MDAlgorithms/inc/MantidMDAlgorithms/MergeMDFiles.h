@@ -60,6 +60,7 @@ private:
   void finalizeOutput(const std::string &outputFile);
 
   uint64_t loadEventsFromSubBoxes(API::IMDNode *TargetBox);
+  uint64_t loadEventsFromSubBoxesConcurrently(API::IMDNode *TargetBox);
 
   // the class which flatten the box structure and deal with it
   DataObjects::MDBoxFlatTree m_BoxStruct;
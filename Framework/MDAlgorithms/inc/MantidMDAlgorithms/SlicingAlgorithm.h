@@ -56,6 +56,10 @@ protected:
   std::unique_ptr<Mantid::Geometry::MDImplicitFunction>
   getGeneralImplicitFunction(const size_t *const chunkMin,
                              const size_t *const chunkMax);
+  bool getAlignedBoundsForChunk(const size_t *const chunkMin,
+                                const size_t *const chunkMax,
+                                std::vector<coord_t> &boundsMin,
+                                std::vector<coord_t> &boundsMax) const;
 
   /// Input workspace
   Mantid::API::IMDWorkspace_sptr m_inWS;
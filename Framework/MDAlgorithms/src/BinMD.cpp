@@ -101,7 +101,9 @@ void BinMD::init() {
  */
 template <typename MDE, size_t nd>
 inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
-                            const size_t *const chunkMax) {
+                            const size_t *const chunkMax,
+                            const coord_t *const boundsMin,
+                            const coord_t *const boundsMax) {
   // An array to hold the rotated/transformed coordinates
   auto outCenter = std::vector<coord_t>(m_outD);
 
@@ -180,7 +182,15 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
   // same bin.
   // So you need to iterate through events.
   const std::vector<MDE> &events = box->getConstEvents();
-  for (auto it = events.begin(); it != events.end(); ++it) {
+  auto begin = events.begin();
+  auto end = events.end();
+  if (boundsMin && boundsMax) {
+    // Only a contiguous range of a Morton-sorted box can be in the chunk
+    const auto range = box->getEventRangeInBounds(boundsMin, boundsMax);
+    begin = events.begin() + range.first;
+    end = events.begin() + range.second;
+  }
+  for (auto it = begin; it != end; ++it) {
     // Cache the center of the event (again for speed)
     const coord_t *inCenter = it->getCenter();
 
@@ -308,6 +318,10 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
       // MDEventWorkspace)
       auto function =
           this->getImplicitFunctionForChunk(chunkMin.data(), chunkMax.data());
+      // For axis-aligned binning, the region of the input covered by the chunk
+      std::vector<coord_t> boundsMin, boundsMax;
+      const bool useBounds = this->getAlignedBoundsForChunk(
+          chunkMin.data(), chunkMax.data(), boundsMin, boundsMax);
 
       // Use getBoxes() to get an array with a pointer to each box
       std::vector<API::IMDNode *> boxes;
@@ -334,7 +348,9 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
         auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxe);
         // Perform the binning in this separate method.
         if (box && !box->getIsMasked())
-          this->binMDBox(box, chunkMin.data(), chunkMax.data());
+          this->binMDBox(box, chunkMin.data(), chunkMax.data(),
+                         useBounds ? boundsMin.data() : nullptr,
+                         useBounds ? boundsMax.data() : nullptr);
 
         // Progress reporting
         if (prog)
@@ -21,8 +21,9 @@ enum wsType {
   Undefined   //< unknown initial state
 };
 
-ConvToMDSelector::ConvToMDSelector(ConvToMDSelector::ConverterType tp)
-    : converterType(tp) {}
+ConvToMDSelector::ConvToMDSelector(ConvToMDSelector::ConverterType tp,
+                                   bool sortEventsByMortonIndex)
+    : converterType(tp), sortEventsByMortonIndex(sortEventsByMortonIndex) {}
 
 /** function which selects the convertor depending on workspace type and
 (possibly, in a future) some workspace properties
@@ -68,7 +69,8 @@ boost::shared_ptr<ConvToMDBase> ConvToMDSelector::convSelector(
       if (converterType == ConvToMDSelector::DEFAULT)
         res = boost::make_shared<ConvToMDEventsWS>();
       else
-        res = boost::make_shared<ConvToMDEventsWSIndexing>();
+        res = boost::make_shared<ConvToMDEventsWSIndexing>(
+            sortEventsByMortonIndex);
       break;
     case (Matrix2DWS):
       res = boost::make_shared<ConvToMDHistoWS>();
@@ -84,7 +86,8 @@ boost::shared_ptr<ConvToMDBase> ConvToMDSelector::convSelector(
       if (converterType == ConvToMDSelector::DEFAULT)
         res = boost::make_shared<ConvToMDEventsWS>();
       else
-        res = boost::make_shared<ConvToMDEventsWSIndexing>();
+        res = boost::make_shared<ConvToMDEventsWSIndexing>(
+            sortEventsByMortonIndex);
     } else {
       res = boost::make_shared<ConvToMDHistoWS>();
     }
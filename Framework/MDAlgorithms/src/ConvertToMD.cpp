@@ -128,6 +128,15 @@ void ConvertToMD::init() {
                   "[Default, Indexed], indexed is the experimental type that "
                   "can speedup the conversion process"
                   "for the big files using the indexing.");
+
+  declareProperty("SortEventsByMortonIndex", false,
+                  "Only used with the Indexed converter. If true, the events "
+                  "of each box are kept in Morton order, so that axis-aligned "
+                  "slicing of the output (BinMD, SliceMD) reads only part of "
+                  "each box. This costs an extra pass over all events.");
+  setPropertySettings("SortEventsByMortonIndex",
+                      std::make_unique<EnabledWhenProperty>(
+                          "ConverterType", IS_EQUAL_TO, "Indexed"));
 }
 //----------------------------------------------------------------------------------------------
 
@@ -285,7 +294,8 @@ void ConvertToMD::exec() {
       getPropertyValue("ConverterType") == "Indexed"
           ? ConvToMDSelector::INDEXED
           : ConvToMDSelector::DEFAULT;
-  ConvToMDSelector AlgoSelector(convType);
+  const bool sortEvents = getProperty("SortEventsByMortonIndex");
+  ConvToMDSelector AlgoSelector(convType, sortEvents);
   this->m_Convertor = AlgoSelector.convSelector(m_InWS2D, this->m_Convertor);
 
   bool ignoreZeros = getProperty("IgnoreZeroSignals");
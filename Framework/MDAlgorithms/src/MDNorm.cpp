@@ -7,6 +7,7 @@
 
 #include "MantidMDAlgorithms/MDNorm.h"
 #include "MantidAPI/CommonBinsValidator.h"
+#include "MantidAPI/ExperimentInfo.h"
 #include "MantidAPI/IMDEventWorkspace.h"
 #include "MantidAPI/InstrumentValidator.h"
 #include "MantidAPI/Run.h"
@@ -18,6 +19,7 @@
 #include "MantidGeometry/Crystal/SpaceGroupFactory.h"
 #include "MantidGeometry/Crystal/SymmetryOperationFactory.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidGeometry/MDGeometry/HKL.h"
 #include "MantidGeometry/MDGeometry/MDFrameFactory.h"
 #include "MantidGeometry/MDGeometry/QSample.h"
@@ -477,6 +479,10 @@ void MDNorm::exec() {
   this->setProperty("OutputDataWorkspace", outputDataWS);
 
   m_numExptInfos = outputDataWS->getNumExperimentInfo();
+  m_detectorCache.clear();
+  m_cachedDetectorInfo = nullptr;
+  m_cachedSpectrumDefinitions =
+      Kernel::cow_ptr<std::vector<SpectrumDefinition>>(nullptr);
   // loop over all experiment infos
   for (uint16_t expInfoIndex = 0; expInfoIndex < m_numExptInfos;
        expInfoIndex++) {
@@ -1134,6 +1140,74 @@ void MDNorm::cacheDimensionXValues() {
   }
 }
 
+/**
+ * Stores the angles, solid angle and flux workspace index of every spectrum
+ * of the given experiment info. The cache is only rebuilt if the detectors
+ * or the grouping of detectors into spectra differ from the ones used to build
+ * it, so that a rotation scan pays for the detector lookups only once.
+ * @param exptInfo - the experiment info to cache the detectors of
+ * @param solidAngleWS - the solid angle workspace, or nullptr
+ * @param integrFlux - the integrated flux workspace
+ */
+void MDNorm::cacheDetectorInformation(
+    const API::ExperimentInfo &exptInfo,
+    const API::MatrixWorkspace_const_sptr &solidAngleWS,
+    const API::MatrixWorkspace_const_sptr &integrFlux) {
+  const auto &spectrumInfo = exptInfo.spectrumInfo();
+  const auto &detectorInfo = exptInfo.detectorInfo();
+  const auto &spectrumDefinitions = spectrumInfo.sharedSpectrumDefinitions();
+  if (m_cachedDetectorInfo &&
+      m_detectorCache.size() == spectrumInfo.size() &&
+      (m_cachedSpectrumDefinitions == spectrumDefinitions ||
+       (m_cachedSpectrumDefinitions && spectrumDefinitions &&
+        *m_cachedSpectrumDefinitions == *spectrumDefinitions)) &&
+      (m_cachedDetectorInfo == &detectorInfo ||
+       m_cachedDetectorInfo->isEquivalent(detectorInfo))) {
+    return;
+  }
+
+  const detid2index_map solidAngDetToIdx =
+      (solidAngleWS) ? solidAngleWS->getDetectorIDToWorkspaceIndexMap()
+                     : detid2index_map();
+  const detid2index_map fluxDetToIdx =
+      (m_diffraction) ? integrFlux->getDetectorIDToWorkspaceIndexMap()
+                      : detid2index_map();
+
+  const auto ndets = static_cast<int64_t>(spectrumInfo.size());
+  m_detectorCache.assign(spectrumInfo.size(), DetectorCacheEntry());
+  PARALLEL_FOR_IF(!solidAngleWS || Kernel::threadSafe(*solidAngleWS))
+  for (int64_t i = 0; i < ndets; i++) {
+    if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) ||
+        spectrumInfo.isMasked(i)) {
+      continue;
+    }
+    auto &entry = m_detectorCache[i];
+    const auto &detector = spectrumInfo.detector(i);
+    // If the detector is a group, this should be the ID of the first detector
+    const auto detID = detector.getID();
+    if (m_diffraction) {
+      auto index = fluxDetToIdx.find(detID);
+      if (index == fluxDetToIdx.end()) {
+        // masked detector in flux, but not in input workspace
+        continue;
+      }
+      entry.fluxIndex = index->second;
+    }
+    if (solidAngleWS) {
+      auto index = solidAngDetToIdx.find(detID);
+      if (index == solidAngDetToIdx.end()) {
+        continue;
+      }
+      entry.solidAngle = solidAngleWS->y(index->second)[0];
+    }
+    entry.theta = detector.getTwoTheta(m_samplePos, m_beamDir);
+    entry.phi = detector.getPhi();
+    entry.skip = false;
+  }
+  m_cachedDetectorInfo = &detectorInfo;
+  m_cachedSpectrumDefinitions = spectrumDefinitions;
+}
+
 /**
  * Computed the normalization for the input workspace. Results are stored in
  * m_normWS
@@ -1168,21 +1242,11 @@ void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues,
   const double protonCharge = currentExptInfo.run().getProtonCharge();
   const auto &spectrumInfo = currentExptInfo.spectrumInfo();
 
-  // Mappings
   const auto ndets = static_cast<int64_t>(spectrumInfo.size());
-  bool haveSA = false;
   API::MatrixWorkspace_const_sptr solidAngleWS =
       getProperty("SolidAngleWorkspace");
   API::MatrixWorkspace_const_sptr integrFlux = getProperty("FluxWorkspace");
-  if (solidAngleWS != nullptr) {
-    haveSA = true;
-  }
-  const detid2index_map solidAngDetToIdx =
-      (haveSA) ? solidAngleWS->getDetectorIDToWorkspaceIndexMap()
-               : detid2index_map();
-  const detid2index_map fluxDetToIdx =
-      (m_diffraction) ? integrFlux->getDetectorIDToWorkspaceIndexMap()
-                      : detid2index_map();
+  cacheDetectorInformation(currentExptInfo, solidAngleWS, integrFlux);
 
   const size_t vmdDims = (m_diffraction) ? 3 : 4;
   std::vector<std::atomic<signal_t>> signalArray(m_normWS->getNPoints());
@@ -1204,39 +1268,18 @@ PRAGMA_OMP(parallel for private(intersections, xValues, yValues, pos, posNew) if
 for (int64_t i = 0; i < ndets; i++) {
   PARALLEL_START_INTERUPT_REGION
 
-  if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) ||
-      spectrumInfo.isMasked(i)) {
+  const auto &detector = m_detectorCache[i];
+  if (detector.skip) {
     continue;
   }
 
-  const auto &detector = spectrumInfo.detector(i);
-  double theta = detector.getTwoTheta(m_samplePos, m_beamDir);
-  double phi = detector.getPhi();
-  // If the dtefctor is a group, this should be the ID of the first detector
-  const auto detID = detector.getID();
-
-  // get the flux spectrum number
-  size_t wsIdx = 0;
-  if (m_diffraction) {
-    auto index = fluxDetToIdx.find(detID);
-    if (index != fluxDetToIdx.end()) {
-      wsIdx = index->second;
-    } else { // masked detector in flux, but not in input workspace
-      continue;
-    }
-  }
-
   // Intersections
-  this->calculateIntersections(intersections, theta, phi, Qtransform,
-                               lowValues[i], highValues[i]);
+  this->calculateIntersections(intersections, detector.theta, detector.phi,
+                               Qtransform, lowValues[i], highValues[i]);
   if (intersections.empty())
     continue;
   // Get solid angle for this contribution
-  double solid = protonCharge;
-  if (haveSA) {
-    solid =
-        solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0] * protonCharge;
-  }
+  const double solid = detector.solidAngle * protonCharge;
   if (m_diffraction) {
     // -- calculate integrals for the intersection --
     // momentum values at intersections
@@ -1251,7 +1294,8 @@ for (int64_t i = 0; i < ndets; i++) {
     // calculate integrals at momenta from xValues by interpolating between
     // points in spectrum sp
     // of workspace integrFlux. The result is stored in yValues
-    calcIntegralsForIntersections(xValues, *integrFlux, wsIdx, yValues);
+    calcIntegralsForIntersections(xValues, *integrFlux, detector.fluxIndex,
+                                  yValues);
   }
 
   // Compute final position in HKL
@@ -5,6 +5,7 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidMDAlgorithms/MergeMD.h"
+#include "MantidAPI/Progress.h"
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidDataObjects/MDBoxIterator.h"
 #include "MantidDataObjects/MDEventFactory.h"
@@ -277,6 +278,106 @@ void MergeMD::doPlus(typename MDEventWorkspace<MDE, nd>::sptr ws2) {
     // std::cout << tim << " to add workspace " << ws2->name() << '\n';
 }
 
+//----------------------------------------------------------------------------------------------
+/** Check whether the top-level boxes of all the inputs coincide with the
+ * top-level boxes of the output workspace. In that case the events of each
+ * top-level box can be merged independently of all the others.
+ *
+ * @return true if all the inputs are in memory and split like the output
+ */
+bool MergeMD::inputsShareBoxStructure() const {
+  std::vector<API::IMDNode *> outBoxes;
+  out->getBoxes(outBoxes, 1, false);
+  if (outBoxes.empty() || outBoxes[0]->isLeaf())
+    return false;
+  const size_t numDims = out->getNumDims();
+
+  std::vector<API::IMDNode *> boxes;
+  for (const auto &ws : m_workspaces) {
+    if (ws->isFileBacked())
+      return false;
+    boxes.clear();
+    ws->getBoxes(boxes, 1, false);
+    if (boxes.size() != outBoxes.size() || boxes[0]->isLeaf())
+      return false;
+    for (size_t i = 1; i < boxes.size(); ++i) {
+      for (size_t d = 0; d < numDims; ++d) {
+        const auto &extents = boxes[i]->getExtents(d);
+        const auto &outExtents = outBoxes[i]->getExtents(d);
+        if (extents.getMin() != outExtents.getMin() ||
+            extents.getMax() != outExtents.getMax())
+          return false;
+      }
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------------------------
+/** Merge all the inputs at once, one top-level box at a time.
+ * Requires inputsShareBoxStructure() to be true, so that the events of the
+ * i-th top-level box of every input all belong to the i-th top-level box of
+ * the output. The top-level boxes are filled in parallel without any locking
+ * between them and the output is split only once at the end.
+ *
+ * @param ws1 ::  the output MDEventWorkspace
+ */
+template <typename MDE, size_t nd>
+void MergeMD::doMergeByBox(typename MDEventWorkspace<MDE, nd>::sptr ws1) {
+  std::vector<typename MDEventWorkspace<MDE, nd>::sptr> inputs;
+  std::vector<uint16_t> runIndexOffsets;
+  for (const auto &ws : m_workspaces) {
+    auto ws2 = boost::dynamic_pointer_cast<MDEventWorkspace<MDE, nd>>(ws);
+    if (!ws2)
+      throw std::runtime_error(
+          "Incompatible workspace types passed to MergeMD.");
+    inputs.emplace_back(ws2);
+    runIndexOffsets.emplace_back(experimentInfoNo.back());
+    experimentInfoNo.pop_back();
+  }
+
+  MDBoxBase<MDE, nd> *box1 = ws1->getBox();
+  const auto numChildren = static_cast<int>(box1->getNumChildren());
+  Progress prog(this, 0.0, 0.9, numChildren);
+
+  PRAGMA_OMP(parallel for schedule(dynamic, 1))
+  for (int i = 0; i < numChildren; i++) {
+    PARALLEL_START_INTERUPT_REGION
+    auto *target = dynamic_cast<MDBoxBase<MDE, nd> *>(box1->getChild(i));
+    std::vector<API::IMDNode *> boxes;
+    // Inputs are added in order so that the events keep the same order as
+    // when merging the workspaces one after the other
+    for (size_t w = 0; w < inputs.size(); ++w) {
+      boxes.clear();
+      inputs[w]->getBox()->getChild(i)->getBoxes(boxes, 1000, true);
+      for (auto *node : boxes) {
+        auto *box = dynamic_cast<MDBox<MDE, nd> *>(node);
+        if (!box || box->getIsMasked())
+          continue;
+        const std::vector<MDE> &events = box->getConstEvents();
+        for (const auto &event : events) {
+          MDE newEvent(event.getSignal(), event.getErrorSquared(),
+                       event.getCenter());
+          copyEvent(event, newEvent, runIndexOffsets[w]);
+          target->addEvent(newEvent);
+        }
+        box->releaseEvents();
+      }
+    }
+    prog.report();
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  ThreadScheduler *ts = new ThreadSchedulerFIFO();
+  ThreadPool tp(ts);
+  ws1->splitAllIfNeeded(ts);
+  tp.joinAll();
+
+  if (ws1->getNPoints() > 0)
+    ws1->setFileNeedsUpdating(true);
+}
+
 //----------------------------------------------------------------------------------------------
 /** Execute the algorithm.
  */
@@ -307,13 +408,19 @@ void MergeMD::exec() {
   // Create a blank output workspace
   this->createOutputWorkspace(inputs);
 
-  // Run PlusMD on each of the input workspaces, in order.
-  double progStep = 1.0 / double(m_workspaces.size());
-  for (size_t i = 0; i < m_workspaces.size(); i++) {
-    g_log.information() << "Adding workspace " << m_workspaces[i]->getName()
-                        << '\n';
-    progress(double(i) * progStep, m_workspaces[i]->getName());
-    CALL_MDEVENT_FUNCTION(doPlus, m_workspaces[i]);
+  if (this->inputsShareBoxStructure()) {
+    g_log.information() << "Input workspaces share the top-level boxes of the "
+                           "output, merging them box by box.\n";
+    CALL_MDEVENT_FUNCTION(doMergeByBox, out);
+  } else {
+    // Run PlusMD on each of the input workspaces, in order.
+    double progStep = 1.0 / double(m_workspaces.size());
+    for (size_t i = 0; i < m_workspaces.size(); i++) {
+      g_log.information() << "Adding workspace " << m_workspaces[i]->getName()
+                          << '\n';
+      progress(double(i) * progStep, m_workspaces[i]->getName());
+      CALL_MDEVENT_FUNCTION(doPlus, m_workspaces[i]);
+    }
   }
 
   this->progress(0.95, "Refreshing cache");
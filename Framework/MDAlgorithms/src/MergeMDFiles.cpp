@@ -11,6 +11,7 @@
 #include "MantidDataObjects/MDBoxBase.h"
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidKernel/CPUTimer.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/VectorHelper.h"
@@ -18,6 +19,8 @@
 #include <Poco/File.h>
 #include <boost/scoped_ptr.hpp>
 
+#include <mutex>
+
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
 using namespace Mantid::DataObjects;
@@ -25,6 +28,12 @@ using namespace Mantid::DataObjects;
 namespace Mantid {
 namespace MDAlgorithms {
 
+namespace {
+/// The NeXus/HDF5 library is not thread safe, so reads from the input files
+/// are serialized across all files and all algorithm instances.
+std::mutex g_fileReadMutex;
+} // namespace
+
 // Register the algorithm into the AlgorithmFactory
 DECLARE_ALGORITHM(MergeMDFiles)
 
@@ -61,7 +70,8 @@ void MergeMDFiles::init() {
 
   declareProperty("Parallel", false,
                   "Run the loading tasks in parallel.\n"
-                  "This can be faster but might use more memory.");
+                  "This can be faster but might use more memory. Only used "
+                  "if no OutputFilename is given.");
 
   declareProperty(std::make_unique<WorkspaceProperty<IMDEventWorkspace>>(
                       "OutputWorkspace", "", Direction::Output),
@@ -188,6 +198,41 @@ uint64_t MergeMDFiles::loadEventsFromSubBoxes(API::IMDNode *TargetBox) {
   return nBoxEvents;
 }
 
+/** Load all of the events from the corresponding boxes of all files into a box
+ * of the output workspace, while other threads do the same for other boxes.
+ * Only the conversion of the data into events runs concurrently, the reads
+ * themselves are serialized.
+ */
+uint64_t
+MergeMDFiles::loadEventsFromSubBoxesConcurrently(API::IMDNode *TargetBox) {
+  /// get rid of the events and averages which are in the memory erroneously
+  /// (from cloning)
+  TargetBox->clear();
+
+  const size_t ID = TargetBox->getID();
+  uint64_t nBoxEvents(0);
+  std::vector<coord_t> table;
+  std::vector<coord_t> block;
+  for (size_t iw = 0; iw < this->m_EventLoader.size(); iw++) {
+    const auto &eventIndex = m_fileComponentsStructure[iw].getEventIndex();
+    const auto numFileEvents = static_cast<size_t>(eventIndex[2 * ID + 1]);
+    if (numFileEvents == 0)
+      continue;
+    {
+      std::lock_guard<std::mutex> lock(g_fileReadMutex);
+      m_EventLoader[iw]->loadBlock(block, eventIndex[2 * ID + 0],
+                                   numFileEvents);
+    }
+    table.insert(table.end(), block.begin(), block.end());
+    nBoxEvents += numFileEvents;
+  }
+
+  // Converts the events of all files in one go, reserving memory exactly
+  if (nBoxEvents > 0)
+    TargetBox->setEventsData(table);
+  return nBoxEvents;
+}
+
 //----------------------------------------------------------------------------------------------
 /** Perform the merging, but clone the initial workspace and use the same
  *splitting
@@ -202,8 +247,9 @@ void MergeMDFiles::doExecByCloning(Mantid::API::IMDEventWorkspace_sptr ws,
   m_OutIWS = ws;
   m_MDEventType = ws->getEventTypeName();
 
-  // Run the tasks in parallel? TODO: enable
-  // bool Parallel = this->getProperty("Parallel");
+  // Boxes can only be filled in parallel if the output is kept in memory, as
+  // the file back end writes the boxes one after the other.
+  const bool parallel = getProperty("Parallel");
 
   // Fix the box controller settings in the output workspace so that it splits
   // normally
@@ -257,41 +303,38 @@ void MergeMDFiles::doExecByCloning(Mantid::API::IMDEventWorkspace_sptr ws,
   this->m_totalLoaded = 0;
   std::vector<API::IMDNode *> &boxes = m_BoxStruct.getBoxes();
 
-  for (size_t ib = 0; ib < numBoxes; ib++) {
-    auto box = boxes[ib];
-    if (!box->isBox())
-      continue;
-    // load all contributed events into current box;
-    this->loadEventsFromSubBoxes(boxes[ib]);
-
-    if (DiskBuf) {
-      if (box->getDataInMemorySize() >
-          0) { // data position has been already pre-calculated
-        box->getISaveable()->save();
-        box->clearDataFromMemory();
-        // Kernel::ISaveable *Saver = box->getISaveable();
-        // DiskBuf->toWrite(Saver);
+  if (parallel && !DiskBuf) {
+    // Each box only receives the events of the same box in every file, so the
+    // boxes are independent. All file reads are serialized, but converting
+    // the data into events runs concurrently.
+    const auto numBoxesInt = static_cast<int64_t>(numBoxes);
+    PRAGMA_OMP(parallel for schedule(dynamic, 1))
+    for (int64_t ib = 0; ib < numBoxesInt; ib++) {
+      PARALLEL_START_INTERUPT_REGION
+      auto box = boxes[ib];
+      if (box->isBox())
+        this->loadEventsFromSubBoxesConcurrently(box);
+      m_progress->report("Loading and merging box data");
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+  } else {
+    for (size_t ib = 0; ib < numBoxes; ib++) {
+      auto box = boxes[ib];
+      if (!box->isBox())
+        continue;
+      // load all contributed events into current box;
+      this->loadEventsFromSubBoxes(boxes[ib]);
+
+      if (DiskBuf) {
+        if (box->getDataInMemorySize() >
+            0) { // data position has been already pre-calculated
+          box->getISaveable()->save();
+          box->clearDataFromMemory();
+        }
       }
+      m_progress->reportIncrement(ib, "Loading and merging box data");
     }
-    // else
-    //{   size_t ID = box->getID();
-    //    uint64_t filePosition = targetEventIndexes[2*ID];
-    //    box->saveAt(saver.get(), filePosition);
-    //}
-    //
-    // if (!Parallel)
-    //{
-    //  // Run the task serially only
-    //  task->run();
-    //  delete task;
-    //}
-    // else
-    //{
-    //  // Enqueue to run in parallel (at the joinAll() call below).
-    //  ts->push(task);
-    //}
-
-    m_progress->reportIncrement(ib, "Loading and merging box data");
   }
   if (DiskBuf) {
     DiskBuf->flushCache();
@@ -179,6 +179,10 @@ void SliceMD::slice(typename MDEventWorkspace<MDE, nd>::sptr ws) {
   // Function defining which events (in the input dimensions) to place in the
   // output
   auto function = this->getImplicitFunctionForChunk(nullptr, nullptr);
+  // For an axis-aligned slice only part of a Morton-sorted box need be read
+  std::vector<coord_t> boundsMin, boundsMax;
+  const bool useBounds =
+      this->getAlignedBoundsForChunk(nullptr, nullptr, boundsMin, boundsMax);
 
   std::vector<API::IMDNode *> boxes;
   // Leaf-only; no depth limit; with the implicit function passed to it.
@@ -208,8 +212,16 @@ void SliceMD::slice(typename MDEventWorkspace<MDE, nd>::sptr ws) {
       coord_t outCenter[ond];
 
       const std::vector<MDE> &events = box->getConstEvents();
+      auto begin = events.cbegin();
+      auto end = events.cend();
+      if (useBounds) {
+        const auto range =
+            box->getEventRangeInBounds(boundsMin.data(), boundsMax.data());
+        begin = events.cbegin() + range.first;
+        end = events.cbegin() + range.second;
+      }
 
-      for (auto it = events.cbegin(); it != events.cend(); ++it) {
+      for (auto it = begin; it != end; ++it) {
         // Cache the center of the event (again for speed)
         const coord_t *inCenter = it->getCenter();
 
@@ -19,6 +19,7 @@
 #include "MantidKernel/VisibleWhenProperty.h"
 
 #include <boost/regex.hpp>
+#include <limits>
 
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
@@ -894,6 +895,42 @@ SlicingAlgorithm::getImplicitFunctionForChunk(const size_t *const chunkMin,
   }
 }
 
+//----------------------------------------------------------------------------------------------
+/** For an axis-aligned slice, get the region of the input workspace covered
+ * by a chunk of the output workspace. The region is padded by a bin on each
+ * side so it safely contains every event that the transform places into the
+ * chunk. It can be used with MDBox::getEventRangeInBounds() to skip events.
+ *
+ * @param chunkMin :: the minimum index in each dimension to consider "valid"
+ *(inclusive). NULL to use the entire range.
+ * @param chunkMax :: the maximum index in each dimension to consider "valid"
+ *(exclusive) NULL to use the entire range.
+ * @param boundsMin :: set to the lower bounds of the region in each input
+ *dimension
+ * @param boundsMax :: set to the upper bounds of the region in each input
+ *dimension
+ * @return false if the slice is not axis-aligned, in which case the bounds are
+ *left unchanged
+ */
+bool SlicingAlgorithm::getAlignedBoundsForChunk(
+    const size_t *const chunkMin, const size_t *const chunkMax,
+    std::vector<coord_t> &boundsMin, std::vector<coord_t> &boundsMax) const {
+  if (!m_axisAligned)
+    return false;
+  const size_t nd = m_inWS->getNumDims();
+  boundsMin.assign(nd, std::numeric_limits<coord_t>::lowest());
+  boundsMax.assign(nd, std::numeric_limits<coord_t>::max());
+  for (size_t bd = 0; bd < m_outD; bd++) {
+    const auto &dim = m_binDimensions[bd];
+    const size_t d = m_dimensionToBinFrom[bd];
+    const coord_t padding = dim->getBinWidth();
+    boundsMin[d] = dim->getX(chunkMin ? chunkMin[bd] : 0) - padding;
+    boundsMax[d] =
+        dim->getX(chunkMax ? chunkMax[bd] : dim->getNBins()) + padding;
+  }
+  return true;
+}
+
 /**
  * Create an MDFrame for the Non-Axis-Aligned case. Make sure that
  * MDFrames onto which the basis vector projects are not mixed, e.g. no mixing
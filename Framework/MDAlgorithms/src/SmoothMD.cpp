@@ -19,6 +19,7 @@
 #include "MantidKernel/PropertyWithValue.h"
 #include <boost/make_shared.hpp>
 #include <boost/tuple/tuple.hpp>
+#include <algorithm>
 #include <limits>
 #include <map>
 #include <numeric>
@@ -145,6 +146,145 @@ KernelVector normaliseKernel(KernelVector kernel) {
   return kernel;
 }
 
+namespace {
+
+/**
+ * @param ws : An MDHistoWorkspace
+ * @return The number of bins along each dimension of the workspace
+ */
+std::vector<size_t> binsPerDimension(const IMDHistoWorkspace &ws) {
+  std::vector<size_t> nBins(ws.getNumDims());
+  for (size_t d = 0; d < nBins.size(); ++d) {
+    nBins[d] = ws.getDimension(d)->getNBins();
+  }
+  return nBins;
+}
+
+/**
+ * Split a linear index into the indexes along each dimension
+ * @param linearIndex : Linear index of a bin
+ * @param nBins : Number of bins along each dimension
+ * @param indexes : Output indexes, one per dimension
+ */
+void indexesFromLinearIndex(size_t linearIndex,
+                            const std::vector<size_t> &nBins,
+                            std::vector<size_t> &indexes) {
+  for (size_t d = 0; d < nBins.size(); ++d) {
+    indexes[d] = linearIndex % nBins[d];
+    linearIndex /= nBins[d];
+  }
+}
+
+/**
+ * Vertex-touching neighbourhood of a bin, computed once for the shape of a
+ * workspace and a width vector. The bin itself is excluded and the offsets
+ * are sorted by linear index, so the neighbours are visited in the same order
+ * as those returned by MDHistoWorkspaceIterator::findNeighbourIndexesByWidth.
+ */
+class NeighbourOffsets {
+public:
+  NeighbourOffsets(const std::vector<size_t> &nBins,
+                   const std::vector<int> &widths)
+      : m_nBins(nBins) {
+    const size_t nd = nBins.size();
+    std::vector<int64_t> strides(nd, 1);
+    for (size_t d = 1; d < nd; ++d) {
+      strides[d] = strides[d - 1] * static_cast<int64_t>(nBins[d - 1]);
+    }
+
+    // Go through every combination of offsets along each dimension
+    std::vector<std::pair<int64_t, std::vector<int>>> entries;
+    std::vector<int> delta(nd);
+    for (size_t d = 0; d < nd; ++d) {
+      delta[d] = -(widths[d] / 2);
+    }
+    size_t d = 0;
+    while (d < nd) {
+      if (std::any_of(delta.cbegin(), delta.cend(),
+                      [](int offset) { return offset != 0; })) {
+        const int64_t linear = std::inner_product(
+            delta.cbegin(), delta.cend(), strides.cbegin(), int64_t(0));
+        entries.emplace_back(linear, delta);
+      }
+      for (d = 0; d < nd; ++d) {
+        if (delta[d] < widths[d] / 2) {
+          ++delta[d];
+          break;
+        }
+        delta[d] = -(widths[d] / 2);
+      }
+    }
+    std::stable_sort(
+        entries.begin(), entries.end(),
+        [](const std::pair<int64_t, std::vector<int>> &lhs,
+           const std::pair<int64_t, std::vector<int>> &rhs) {
+          return lhs.first < rhs.first;
+        });
+
+    m_linear.reserve(entries.size());
+    m_deltas.reserve(entries.size() * nd);
+    for (const auto &entry : entries) {
+      m_linear.emplace_back(entry.first);
+      m_deltas.insert(m_deltas.end(), entry.second.cbegin(),
+                      entry.second.cend());
+    }
+  }
+
+  /// @return The number of neighbours in the neighbourhood
+  size_t size() const { return m_linear.size(); }
+
+  /**
+   * @param i : Index of the neighbour
+   * @param linearIndex : Linear index of the bin
+   * @param indexes : Indexes of the bin along each dimension
+   * @param neighbourIndex : Output linear index of the neighbour
+   * @return True if the neighbour lies within the workspace
+   */
+  bool neighbour(size_t i, size_t linearIndex,
+                 const std::vector<size_t> &indexes,
+                 size_t &neighbourIndex) const {
+    const int *delta = m_deltas.data() + i * m_nBins.size();
+    for (size_t d = 0; d < m_nBins.size(); ++d) {
+      const auto index = static_cast<int64_t>(indexes[d]) + delta[d];
+      if (index < 0 || index >= static_cast<int64_t>(m_nBins[d])) {
+        return false;
+      }
+    }
+    neighbourIndex =
+        static_cast<size_t>(static_cast<int64_t>(linearIndex) + m_linear[i]);
+    return true;
+  }
+
+private:
+  std::vector<size_t> m_nBins;
+  std::vector<int64_t> m_linear;
+  std::vector<int> m_deltas;
+};
+
+/**
+ * Renormalise a kernel for every position along a dimension, so that the
+ * kernels truncated by the edges of the workspace are only computed once.
+ * @param kernel : The 1D kernel, centred on the middle element
+ * @param nBins : Number of bins along the dimension
+ * @return The renormalised kernel for each bin along the dimension
+ */
+std::vector<KernelVector> kernelsAlongDimension(const KernelVector &kernel,
+                                                const size_t nBins) {
+  const auto halfWidth = static_cast<int64_t>(kernel.size() / 2);
+  std::vector<KernelVector> kernels;
+  kernels.reserve(nBins);
+  std::vector<bool> validity(kernel.size());
+  for (size_t position = 0; position < nBins; ++position) {
+    for (size_t i = 0; i < kernel.size(); ++i) {
+      const auto index = static_cast<int64_t>(position + i) - halfWidth;
+      validity[i] = index >= 0 && index < static_cast<int64_t>(nBins);
+    }
+    kernels.emplace_back(renormaliseKernel(kernel, validity));
+  }
+  return kernels;
+}
+} // namespace
+
 // Register the algorithm into the AlgorithmFactory
 DECLARE_ALGORITHM(SmoothMD)
 
@@ -192,6 +332,24 @@ SmoothMD::hatSmooth(IMDHistoWorkspace_const_sptr toSmooth,
 
   auto iterators = toSmooth->createIterators(nThreads, nullptr);
 
+  // Explicitly cast the doubles to int
+  // We've already checked in the validator that the doubles we have are odd
+  // integer values and well below max int
+  std::vector<int> widthVectorInt;
+  widthVectorInt.resize(widthVector.size());
+  std::transform(widthVector.cbegin(), widthVector.cend(),
+                 widthVectorInt.begin(),
+                 [](double w) -> int { return static_cast<int>(w); });
+
+  const auto nBins = binsPerDimension(*toSmooth);
+  const NeighbourOffsets neighbours(nBins, widthVectorInt);
+  const signal_t *signals = toSmooth->getSignalArray();
+  const signal_t *errorsSquared = toSmooth->getErrorSquaredArray();
+  const signal_t *weights =
+      useWeights ? (*weightingWS)->getSignalArray() : nullptr;
+  signal_t *outSignals = outWS->mutableSignalArray();
+  signal_t *outErrorsSquared = outWS->mutableErrorSquaredArray();
+
   PARALLEL_FOR_NO_WSP_CHECK()
   for (int it = 0; it < int(iterators.size()); ++it) { // NOLINT
 
@@ -204,57 +362,41 @@ SmoothMD::hatSmooth(IMDHistoWorkspace_const_sptr toSmooth,
           "Failed to cast IMDIterator to MDHistoWorkspaceIterator");
     }
 
+    std::vector<size_t> indexes(nBins.size());
     do {
-      // Gets all vertex-touching neighbours
       size_t iteratorIndex = iterator->getLinearIndex();
 
-      if (useWeights) {
-
-        // Check that we could measure here.
-        if ((*weightingWS)->getSignalAt(iteratorIndex) == 0) {
-
-          outWS->setSignalAt(iteratorIndex,
-                             std::numeric_limits<double>::quiet_NaN());
-          outWS->setErrorSquaredAt(iteratorIndex,
-                                   std::numeric_limits<double>::quiet_NaN());
-
-          continue; // Skip we couldn't measure here.
-        }
+      // Check that we could measure here.
+      if (weights && weights[iteratorIndex] == 0) {
+        outSignals[iteratorIndex] = std::numeric_limits<double>::quiet_NaN();
+        outErrorsSquared[iteratorIndex] =
+            std::numeric_limits<double>::quiet_NaN();
+        continue; // Skip we couldn't measure here.
       }
 
-      // Explicitly cast the doubles to int
-      // We've already checked in the validator that the doubles we have are odd
-      // integer values and well below max int
-      std::vector<int> widthVectorInt;
-      widthVectorInt.resize(widthVector.size());
-      std::transform(widthVector.cbegin(), widthVector.cend(),
-                     widthVectorInt.begin(),
-                     [](double w) -> int { return static_cast<int>(w); });
-
-      std::vector<size_t> neighbourIndexes =
-          iterator->findNeighbourIndexesByWidth(widthVectorInt);
-
-      size_t nNeighbours = neighbourIndexes.size();
-      double sumSignal = iterator->getSignal();
+      // Sum over all vertex-touching neighbours
+      indexesFromLinearIndex(iteratorIndex, nBins, indexes);
+      size_t nNeighbours = 0;
+      double sumSignal = signals[iteratorIndex];
       double sumSqError = iterator->getError();
-      for (auto neighbourIndex : neighbourIndexes) {
-        if (useWeights) {
-          if ((*weightingWS)->getSignalAt(neighbourIndex) == 0) {
-            // Nothing measured here. We cannot use that neighbouring point.
-            nNeighbours -= 1;
-            continue;
-          }
+      size_t neighbourIndex = 0;
+      for (size_t i = 0; i < neighbours.size(); ++i) {
+        if (!neighbours.neighbour(i, iteratorIndex, indexes, neighbourIndex)) {
+          continue;
+        }
+        if (weights && weights[neighbourIndex] == 0) {
+          // Nothing measured here. We cannot use that neighbouring point.
+          continue;
         }
-        sumSignal += toSmooth->getSignalAt(neighbourIndex);
-        double error = toSmooth->getErrorAt(neighbourIndex);
-        sumSqError += (error * error);
+        sumSignal += signals[neighbourIndex];
+        sumSqError += errorsSquared[neighbourIndex];
+        ++nNeighbours;
       }
 
       // Calculate the mean
-      outWS->setSignalAt(iteratorIndex, sumSignal / double(nNeighbours + 1));
+      outSignals[iteratorIndex] = sumSignal / double(nNeighbours + 1);
       // Calculate the sample variance
-      outWS->setErrorSquaredAt(iteratorIndex,
-                               sumSqError / double(nNeighbours + 1));
+      outErrorsSquared[iteratorIndex] = sumSqError / double(nNeighbours + 1);
 
       progress.report();
 
@@ -302,6 +444,12 @@ SmoothMD::gaussianSmooth(IMDHistoWorkspace_const_sptr toSmooth,
   const int nThreads = Mantid::API::FrameworkManager::Instance()
                            .getNumOMPThreads(); // NThreads to Request
 
+  const auto nBins = binsPerDimension(*toSmooth);
+  const signal_t *weights =
+      useWeights ? (*weightingWS)->getSignalArray() : nullptr;
+  // Distance between neighbouring bins along the current dimension
+  size_t stride = 1;
+
   auto write_ws = tempWS;
   for (size_t dimension_number = 0; dimension_number < widthVector.size();
        ++dimension_number) {
@@ -318,6 +466,15 @@ SmoothMD::gaussianSmooth(IMDHistoWorkspace_const_sptr toSmooth,
       write_ws = outWS;
     }
 
+    const size_t nBinsAlong = nBins[dimension_number];
+    const auto kernels = kernelsAlongDimension(
+        gaussian_kernels[dimension_number], nBinsAlong);
+    const size_t halfWidth = gaussian_kernels[dimension_number].size() / 2;
+    const signal_t *readSignals = read_ws->getSignalArray();
+    const signal_t *readErrorsSquared = read_ws->getErrorSquaredArray();
+    signal_t *writeSignals = write_ws->mutableSignalArray();
+    signal_t *writeErrorsSquared = write_ws->mutableErrorSquaredArray();
+
     PARALLEL_FOR_NO_WSP_CHECK()
     for (int it = 0; it < int(iterators.size()); ++it) { // NOLINT
 
@@ -334,51 +491,42 @@ SmoothMD::gaussianSmooth(IMDHistoWorkspace_const_sptr toSmooth,
         // Gets linear index at current position
         size_t iteratorIndex = iterator->getLinearIndex();
 
-        if (useWeights) {
-
-          // Check that we could measure here.
-          if ((*weightingWS)->getSignalAt(iteratorIndex) == 0) {
-
-            write_ws->setSignalAt(iteratorIndex,
-                                  std::numeric_limits<double>::quiet_NaN());
-            write_ws->setErrorSquaredAt(
-                iteratorIndex, std::numeric_limits<double>::quiet_NaN());
-
-            continue; // Skip we couldn't measure here.
-          }
+        // Check that we could measure here.
+        if (weights && weights[iteratorIndex] == 0) {
+          writeSignals[iteratorIndex] =
+              std::numeric_limits<double>::quiet_NaN();
+          writeErrorsSquared[iteratorIndex] =
+              std::numeric_limits<double>::quiet_NaN();
+          continue; // Skip we couldn't measure here.
         }
 
-        std::pair<std::vector<size_t>, std::vector<bool>> indexesAndValidity =
-            iterator->findNeighbourIndexesByWidth1D(
-                static_cast<int>(gaussian_kernels[dimension_number].size()),
-                static_cast<int>(dimension_number));
-        std::vector<size_t> neighbourIndexes = std::get<0>(indexesAndValidity);
-        std::vector<bool> indexValidity = std::get<1>(indexesAndValidity);
-        auto normalised_kernel = renormaliseKernel(
-            gaussian_kernels[dimension_number], indexValidity);
+        // Kernel renormalised for the position along this dimension and the
+        // range of its elements that fall inside the workspace
+        const size_t position = (iteratorIndex / stride) % nBinsAlong;
+        const auto &kernel = kernels[position];
+        const size_t first = position < halfWidth ? halfWidth - position : 0;
+        const size_t last =
+            std::min(kernel.size(), halfWidth + nBinsAlong - position);
 
         // Convolve signal with kernel
         double sumSignal = 0;
         double sumSquareError = 0;
-        double error = 0;
-        for (size_t i = 0; i < neighbourIndexes.size(); ++i) {
-          if (indexValidity[i]) {
-            sumSignal += read_ws->getSignalAt(neighbourIndexes[i]) *
-                         normalised_kernel[i];
-            error =
-                read_ws->getErrorAt(neighbourIndexes[i]) * normalised_kernel[i];
-            sumSquareError += error * error;
-          }
-
-          write_ws->setSignalAt(iteratorIndex, sumSignal);
-          write_ws->setErrorSquaredAt(iteratorIndex, sumSquareError);
+        for (size_t i = first; i < last; ++i) {
+          const size_t neighbourIndex =
+              iteratorIndex + i * stride - halfWidth * stride;
+          sumSignal += readSignals[neighbourIndex] * kernel[i];
+          sumSquareError +=
+              readErrorsSquared[neighbourIndex] * kernel[i] * kernel[i];
         }
+        writeSignals[iteratorIndex] = sumSignal;
+        writeErrorsSquared[iteratorIndex] = sumSquareError;
         progress.report();
 
       } while (iterator->next());
       PARALLEL_END_INTERUPT_REGION
     }
     PARALLEL_CHECK_INTERUPT_REGION
+    stride *= nBinsAlong;
   }
 
   return write_ws;
@@ -88,7 +88,7 @@ public:
     TS_ASSERT_THROWS_NOTHING(pAlg->initialize())
     TS_ASSERT(pAlg->isInitialized())
 
-    TSM_ASSERT_EQUALS("algorithm should have 26 properties", 26,
+    TSM_ASSERT_EQUALS("algorithm should have 27 properties", 27,
                       (size_t)(pAlg->getProperties().size()));
   }
 
@@ -535,6 +535,47 @@ public:
     }
   }
 
+  void test_indexed_converter_sorts_events_only_on_request() {
+    auto alg = Mantid::API::AlgorithmManager::Instance().create(
+        "CreateSampleWorkspace");
+    alg->initialize();
+    alg->setChild(true);
+    alg->setProperty("WorkspaceType", "Event");
+    alg->setProperty("BankPixelWidth", 4);
+    alg->setProperty("NumEvents", 100);
+    alg->setPropertyValue("OutputWorkspace", "dummy");
+    alg->execute();
+    Mantid::API::MatrixWorkspace_sptr ws = alg->getProperty("OutputWorkspace");
+
+    for (const bool sortEvents : {false, true}) {
+      ConvertToMD convertAlg;
+      convertAlg.setChild(true);
+      convertAlg.initialize();
+      convertAlg.setProperty("InputWorkspace", ws);
+      convertAlg.setPropertyValue("OutputWorkspace", "dummy");
+      convertAlg.setProperty("QDimensions", "Q3D");
+      convertAlg.setProperty("dEAnalysisMode", "Elastic");
+      convertAlg.setPropertyValue("MinValues", "-10,-10,-10");
+      convertAlg.setPropertyValue("MaxValues", "10,10,10");
+      convertAlg.setPropertyValue("SplitInto", "2");
+      convertAlg.setProperty("SplitThreshold", 10);
+      convertAlg.setProperty("ConverterType", "Indexed");
+      convertAlg.setProperty("SortEventsByMortonIndex", sortEvents);
+      TS_ASSERT_THROWS_NOTHING(convertAlg.execute());
+      IMDEventWorkspace_sptr outWS = convertAlg.getProperty("OutputWorkspace");
+
+      std::vector<Mantid::API::IMDNode *> boxes;
+      outWS->getBoxes(boxes, 1000, true);
+      TS_ASSERT(!boxes.empty());
+      for (auto *node : boxes) {
+        auto *box = dynamic_cast<MDBox<MDEvent<3>, 3> *>(node);
+        TS_ASSERT(box);
+        if (box)
+          TS_ASSERT_EQUALS(box->isSortedByMortonIndex(), sortEvents);
+      }
+    }
+  }
+
 private:
   void checkHistogramsHaveBeenStored(const std::string &wsName,
                                      double val = 0.34, double bin_min = 0.3,
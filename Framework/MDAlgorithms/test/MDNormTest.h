@@ -0,0 +1,123 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/IMDEventWorkspace.h"
+#include "MantidAPI/IMDHistoWorkspace.h"
+#include "MantidAPI/Run.h"
+#include "MantidGeometry/MDGeometry/GeneralFrame.h"
+#include "MantidGeometry/MDGeometry/QSample.h"
+#include "MantidMDAlgorithms/CreateMDWorkspace.h"
+#include "MantidMDAlgorithms/MDNorm.h"
+#include "MantidTestHelpers/ComponentCreationHelper.h"
+#include <cxxtest/TestSuite.h>
+
+using Mantid::MDAlgorithms::MDNorm;
+using namespace Mantid::API;
+using namespace Mantid::Geometry;
+
+class MDNormTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MDNormTest *createSuite() { return new MDNormTest(); }
+  static void destroySuite(MDNormTest *suite) { delete suite; }
+
+  void test_Init() {
+    MDNorm alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT(alg.isInitialized())
+  }
+
+  void test_runs_differing_only_in_grouping() {
+    // The detector cache must not be reused for a run with the same
+    // detectors but a different grouping, so the order of runs is irrelevant
+    auto ungrouped = createExperimentInfo(false);
+    auto grouped = createExperimentInfo(true);
+    auto forward = runMDNorm(createMDWorkspace("MDNormTest_forward",
+                                               {ungrouped, grouped}));
+    auto backward = runMDNorm(createMDWorkspace("MDNormTest_backward",
+                                                {grouped, ungrouped}));
+    TS_ASSERT_EQUALS(forward->getNPoints(), backward->getNPoints());
+    double total = 0.;
+    for (size_t i = 0; i < forward->getNPoints(); ++i) {
+      TS_ASSERT_DELTA(forward->getSignalAt(i), backward->getSignalAt(i),
+                      1e-10);
+      total += forward->getSignalAt(i);
+    }
+    TS_ASSERT_LESS_THAN(0., total);
+    AnalysisDataService::Instance().clear();
+  }
+
+private:
+  ExperimentInfo_sptr createExperimentInfo(const bool grouped) {
+    std::vector<double> L2{1, 1, 1}, pol{0.1, 0.2, 0.3}, azi{0, 1, 2};
+    auto inst =
+        ComponentCreationHelper::createCylInstrumentWithDetInGivenPositions(
+            L2, pol, azi);
+    inst->setName("Test");
+    auto ei = boost::make_shared<ExperimentInfo>();
+    ei->setInstrument(inst);
+    if (grouped) {
+      // Same detectors, but the first two are summed into one spectrum
+      ei->setNumberOfDetectorGroups(3);
+      ei->setDetectorGrouping(0, {1, 2});
+      ei->setDetectorGrouping(1, {3});
+      ei->setDetectorGrouping(2, {});
+    }
+    std::vector<double> high(3, 5.), low(3, -5.);
+    ei->mutableRun().addProperty("MDNorm_high", high);
+    ei->mutableRun().addProperty("MDNorm_low", low);
+    ei->mutableRun().addProperty("Ei", 10.);
+    ei->mutableRun().setProtonCharge(1.);
+    return ei;
+  }
+
+  IMDEventWorkspace_sptr
+  createMDWorkspace(const std::string &name,
+                    const std::vector<ExperimentInfo_sptr> &exptInfos) {
+    Mantid::MDAlgorithms::CreateMDWorkspace algC;
+    algC.initialize();
+    algC.setProperty("Dimensions", "4");
+    algC.setPropertyValue("Extents", "-3,3,-3,3,-3,3,-5,5");
+    algC.setPropertyValue("Frames", QSample::QSampleName + "," +
+                                        QSample::QSampleName + "," +
+                                        QSample::QSampleName + "," +
+                                        GeneralFrame::GeneralFrameName);
+    algC.setPropertyValue("Names", "Q_sample_x,Q_sample_y,Q_sample_z,DeltaE");
+    algC.setPropertyValue("Units", "U,U,U,meV");
+    algC.setPropertyValue("OutputWorkspace", name);
+    algC.execute();
+    auto ws = AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>(
+        name);
+    TS_ASSERT(ws);
+    for (const auto &ei : exptInfos)
+      ws->addExperimentInfo(ei);
+    return ws;
+  }
+
+  IMDHistoWorkspace_sptr runMDNorm(const IMDEventWorkspace_sptr &inputWS) {
+    MDNorm alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspace", inputWS);
+    alg.setProperty("RLU", false);
+    alg.setPropertyValue("Dimension0Binning", "-3,0.5,3");
+    alg.setPropertyValue("Dimension1Binning", "-3,0.5,3");
+    alg.setPropertyValue("Dimension2Binning", "-3,0.5,3");
+    alg.setPropertyValue("Dimension3Name", "DeltaE");
+    alg.setPropertyValue("Dimension3Binning", "-5,5");
+    alg.setPropertyValue("OutputWorkspace", "out");
+    alg.setPropertyValue("OutputDataWorkspace", "outData");
+    alg.setPropertyValue("OutputNormalizationWorkspace", "outNorm");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+    Workspace_sptr norm = alg.getProperty("OutputNormalizationWorkspace");
+    return boost::dynamic_pointer_cast<IMDHistoWorkspace>(norm);
+  }
+};
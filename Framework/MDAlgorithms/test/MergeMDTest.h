@@ -231,4 +231,38 @@ public:
     // Remove workspace from the data service.
     AnalysisDataService::Instance().remove(outWSName);
   }
+
+  void test_merge_by_box_matches_merge_by_workspace() {
+    // SplitInto=2 gives the output the top-level boxes of the inputs, so they
+    // are merged box by box. SplitInto=3 adds one workspace after the other.
+    auto byBox = mergeWithSplitInto("MergeMDTest_byBox", "2");
+    auto byWorkspace = mergeWithSplitInto("MergeMDTest_byWorkspace", "3");
+    TS_ASSERT(byBox);
+    TS_ASSERT(byWorkspace);
+    TS_ASSERT_EQUALS(byBox->getNPoints(), 3 * 2 * 2 * 2);
+    TS_ASSERT_EQUALS(byBox->getNPoints(), byWorkspace->getNPoints());
+    TS_ASSERT_DELTA(byBox->getBox()->getSignal(),
+                    byWorkspace->getBox()->getSignal(), 1e-6);
+    TS_ASSERT_EQUALS(byBox->getNumExperimentInfo(), 3);
+
+    AnalysisDataService::Instance().remove("MergeMDTest_byBox");
+    AnalysisDataService::Instance().remove("MergeMDTest_byWorkspace");
+  }
+
+private:
+  MDEventWorkspace3::sptr mergeWithSplitInto(const std::string &wsName,
+                                             const std::string &splitInto) {
+    MergeMD alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setPropertyValue("InputWorkspaces", "mde3,mde3,mde3"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("SplitInto", splitInto));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", wsName));
+    TS_ASSERT_THROWS_NOTHING(alg.execute(););
+    TS_ASSERT(alg.isExecuted());
+    auto ws =
+        AnalysisDataService::Instance().retrieveWS<MDEventWorkspace3>(wsName);
+    ws->refreshCache();
+    return ws;
+  }
 };
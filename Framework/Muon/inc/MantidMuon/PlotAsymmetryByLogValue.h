@@ -66,6 +66,8 @@ private:
   void exec() override;
   // Load run, apply dead time corrections and detector grouping
   API::Workspace_sptr doLoad(size_t runNumber);
+  // Key identifying a run processed by doLoad
+  std::string processedRunKey(const std::string &filename) const;
   // Analyse loaded run
   void doAnalysis(API::Workspace_sptr loadedWs, size_t index);
   // Parse run names
@@ -111,6 +113,8 @@ private:
   std::string m_dtcType;
   /// File to read corrections from
   std::string m_dtcFile;
+  /// Corrections read from m_dtcFile, shared by all runs
+  API::Workspace_sptr m_customDeadTimes;
   /// Store forward spectra
   std::vector<int> m_forward_list;
   /// Store backward spectra
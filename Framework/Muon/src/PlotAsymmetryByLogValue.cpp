@@ -4,10 +4,16 @@
 //     NScD Oak Ridge National Laboratory, European Spallation Source
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
+#include <algorithm>
 #include <cmath>
+#include <future>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/AnalysisDataServiceObserver.h"
 #include "MantidAPI/FileFinder.h"
 #include "MantidAPI/FileProperty.h"
 #include "MantidAPI/Progress.h"
@@ -22,6 +28,7 @@
 #include "MantidHistogramData/Histogram.h"
 #include "MantidHistogramData/HistogramBuilder.h"
 #include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/MandatoryValidator.h"
 #include "MantidKernel/PropertyWithValue.h"
@@ -69,6 +76,101 @@ bool convertLogToDouble(const Mantid::Kernel::Property *property, double &value,
   return false;
 }
 
+/// Configuration key of the memory, in MB, the processed runs may use. Zero
+/// disables the cache.
+const std::string CACHE_SIZE_KEY = "plotasymmetrybylogvalue.cache.mb";
+/// The memory the processed runs may use if the key is not set, in MB
+constexpr int DEFAULT_CACHE_SIZE_MB = 256;
+
+/**
+ * Runs that have been loaded, corrected and grouped, kept between executions
+ * so that a series of runs can be analysed again, e.g. against another log,
+ * without reading the files again. The least recently used runs are dropped
+ * when the runs use more memory than configured. The cache is emptied when
+ * the AnalysisDataService is cleared.
+ */
+class ProcessedRunCache : public Mantid::API::AnalysisDataServiceObserver {
+public:
+  ProcessedRunCache() { observeClear(); }
+
+  /// Returns the run stored under key, or nullptr if there is none
+  Mantid::API::Workspace_sptr find(const std::string &key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto found = m_index.find(key);
+    if (found == m_index.end())
+      return nullptr;
+    m_runs.splice(m_runs.begin(), m_runs, found->second);
+    return found->second->ws;
+  }
+
+  /// Stores a run under key, replacing any run already stored under it
+  void insert(const std::string &key, Mantid::API::Workspace_sptr ws) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto found = m_index.find(key);
+    if (found != m_index.end())
+      erase(found->second);
+    const size_t memory = ws->getMemorySize();
+    m_runs.push_front({key, std::move(ws), memory});
+    m_index[key] = m_runs.begin();
+    m_memory += memory;
+    const auto maxMemory = maxMemorySize();
+    while (!m_runs.empty() && m_memory > maxMemory)
+      erase(std::prev(m_runs.end()));
+  }
+
+  /// Drops all runs
+  void clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_runs.clear();
+    m_index.clear();
+    m_memory = 0;
+  }
+
+private:
+  struct Entry {
+    std::string key;
+    Mantid::API::Workspace_sptr ws;
+    size_t memory;
+  };
+
+  void clearHandle() override { clear(); }
+
+  void erase(std::list<Entry>::iterator entry) {
+    m_memory -= entry->memory;
+    m_index.erase(entry->key);
+    m_runs.erase(entry);
+  }
+
+  /// The memory the runs may use, in bytes, read on every insertion so that
+  /// changes of the configuration take effect immediately
+  static size_t maxMemorySize() {
+    const auto megabytes =
+        Mantid::Kernel::ConfigService::Instance().getValue<int>(
+            CACHE_SIZE_KEY);
+    return static_cast<size_t>(
+               std::max(megabytes.get_value_or(DEFAULT_CACHE_SIZE_MB), 0)) *
+           1024 * 1024;
+  }
+
+  std::mutex m_mutex;
+  /// The runs, the most recently used first
+  std::list<Entry> m_runs;
+  std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+  /// The memory used by all runs, in bytes
+  size_t m_memory{0};
+};
+
+/// The processed runs shared by all instances of the algorithm
+ProcessedRunCache &processedRuns() {
+  static ProcessedRunCache cache;
+  return cache;
+}
+
+/// The time a file was last modified, in microseconds
+Poco::Timestamp::TimeVal lastModified(const std::string &filename) {
+  return Poco::File(filename).getLastModified().epochMicroseconds();
+}
+
 } // namespace
 
 namespace Mantid {
@@ -83,11 +185,11 @@ DECLARE_ALGORITHM(PlotAsymmetryByLogValue)
 
 PlotAsymmetryByLogValue::PlotAsymmetryByLogValue()
     : Algorithm(), m_filenameBase(), m_filenameExt(), m_filenameZeros(),
-      m_dtcType(), m_dtcFile(), m_forward_list(), m_backward_list(),
-      m_int(true), m_red(-1), m_green(-1), m_minTime(-1.0), m_maxTime(-1.0),
-      m_logName(), m_logFunc(), m_logValue(), m_redY(), m_redE(), m_greenY(),
-      m_greenE(), m_sumY(), m_sumE(), m_diffY(), m_diffE(),
-      m_allProperties("default"), m_currResName("__PABLV_results"),
+      m_dtcType(), m_dtcFile(), m_customDeadTimes(), m_forward_list(),
+      m_backward_list(), m_int(true), m_red(-1), m_green(-1), m_minTime(-1.0),
+      m_maxTime(-1.0), m_logName(), m_logFunc(), m_logValue(), m_redY(),
+      m_redE(), m_greenY(), m_greenE(), m_sumY(), m_sumE(), m_diffY(),
+      m_diffE(), m_allProperties("default"), m_currResName("__PABLV_results"),
       m_firstStart_ns(0) {}
 
 /** Initialisation method. Declares properties to be used in algorithm.
@@ -168,24 +270,42 @@ void PlotAsymmetryByLogValue::exec() {
 
   Progress progress(this, 0, 1, ie - is + 1);
 
-  // Loop through runs
+  // Check which runs were already analysed
+  std::vector<size_t> runsToLoad;
   for (size_t i = is; i <= ie; i++) {
-
-    // Check if run i was already loaded
-    std::ostringstream logMessage;
     if (m_logValue.count(i)) {
-      logMessage << "Found run " << i;
+      progress.report("Found run " + std::to_string(i));
     } else {
-      // Load run, apply dead time corrections and detector grouping
-      Workspace_sptr loadedWs = doLoad(i);
+      runsToLoad.emplace_back(i);
+    }
+  }
 
-      if (loadedWs) {
-        // Analyse loadedWs
-        doAnalysis(loadedWs, i);
-      }
-      logMessage << "Loaded run " << i;
+  // Dead times from a file are the same for every run
+  m_customDeadTimes.reset();
+  if (!runsToLoad.empty() && m_dtcType == "FromSpecifiedFile") {
+    m_customDeadTimes = loadCorrectionsFromFile(m_dtcFile);
+  }
+
+  // Load run, apply dead time corrections and detector grouping on another
+  // thread, one run ahead of the analysis. Only one run is loaded at a time
+  // because the NeXus library is not thread safe.
+  auto prefetch = [this](size_t runNumber) {
+    return std::async(std::launch::async,
+                      [this, runNumber] { return doLoad(runNumber); });
+  };
+  std::future<Workspace_sptr> nextRun;
+  if (!runsToLoad.empty())
+    nextRun = prefetch(runsToLoad.front());
+  for (size_t k = 0; k < runsToLoad.size(); k++) {
+    Workspace_sptr loadedWs = nextRun.get();
+    if (k + 1 < runsToLoad.size())
+      nextRun = prefetch(runsToLoad[k + 1]);
+
+    if (loadedWs) {
+      // Analyse loadedWs
+      doAnalysis(loadedWs, runsToLoad[k]);
     }
-    progress.report(logMessage.str());
+    progress.report("Loaded run " + std::to_string(runsToLoad[k]));
   }
 
   // Create the 2D workspace for the output
@@ -327,6 +447,11 @@ Workspace_sptr PlotAsymmetryByLogValue::doLoad(size_t runNumber) {
     return Workspace_sptr();
   }
 
+  // Reuse the run if it was processed in the same way before
+  const std::string runKey = processedRunKey(fn.str());
+  if (auto processedWs = processedRuns().find(runKey))
+    return processedWs;
+
   // Load run
   IAlgorithm_sptr load = createChildAlgorithm("LoadMuonNexus");
   load->setPropertyValue("Filename", fn.str());
@@ -341,8 +466,8 @@ Workspace_sptr PlotAsymmetryByLogValue::doLoad(size_t runNumber) {
     Workspace_sptr deadTimes;
 
     if (m_dtcType == "FromSpecifiedFile") {
-      // Load corrections from file
-      deadTimes = loadCorrectionsFromFile(m_dtcFile);
+      // Corrections loaded from file
+      deadTimes = m_customDeadTimes;
     } else {
       // Load corrections from run
       deadTimes = load->getProperty("DeadTimeTable");
@@ -368,9 +493,31 @@ Workspace_sptr PlotAsymmetryByLogValue::doLoad(size_t runNumber) {
   // Apply grouping
   groupDetectors(loadedWs, grouping);
 
+  processedRuns().insert(runKey, loadedWs);
   return loadedWs;
 }
 
+/**  Identifies a run file together with the corrections and grouping applied
+ *   to it
+ *   @param filename :: [input] The full name of the run file
+ *   @return :: Key of the processed run
+ */
+std::string
+PlotAsymmetryByLogValue::processedRunKey(const std::string &filename) const {
+  std::ostringstream key;
+  key << filename << ',' << lastModified(filename) << ',' << m_dtcType;
+  if (m_dtcType == "FromSpecifiedFile") {
+    key << ',' << m_dtcFile << ',' << lastModified(m_dtcFile);
+  }
+  key << ",forward";
+  for (const auto spectrum : m_forward_list)
+    key << ' ' << spectrum;
+  key << ",backward";
+  for (const auto spectrum : m_backward_list)
+    key << ' ' << spectrum;
+  return key.str();
+}
+
 /**  Load dead-time corrections from specified file
  *   @param deadTimeFile :: [input] File to read corrections from
  *   @return :: Deadtime corrections loaded from file
@@ -844,11 +991,14 @@ double PlotAsymmetryByLogValue::getLogValue(MatrixWorkspace &ws) {
   }
 
   // Otherwise, try converting the log value to a double
-  auto *property = run.getLogData(m_logName);
-  if (!property) {
+  const auto *log = run.getLogData(m_logName);
+  if (!log) {
     throw std::invalid_argument("Log " + m_logName + " does not exist.");
   }
-  property->filterByTime(start, end);
+  // Filter a copy as the workspace may be shared with the processed runs
+  std::unique_ptr<Property> filteredLog(log->clone());
+  filteredLog->filterByTime(start, end);
+  const auto *property = filteredLog.get();
 
   double value = 0;
   // try different property types
@@ -16,6 +16,7 @@
 #include "MantidDataHandling/LoadMuonNexus.h"
 #include "MantidDataHandling/SaveNexus.h"
 #include "MantidDataObjects/Workspace2D.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidMuon/PlotAsymmetryByLogValue.h"
 #include <cxxtest/TestSuite.h>
 
@@ -583,6 +584,67 @@ public:
     TS_ASSERT_EQUALS(watcher.getFoundCount(), 2);  // reused 2
   }
 
+  void test_replot_against_another_log() {
+    PlotAsymmetryByLogValue alg;
+    alg.initialize();
+    alg.setPropertyValue("FirstRun", firstRun);
+    alg.setPropertyValue("LastRun", lastRun);
+    alg.setPropertyValue("OutputWorkspace", "PlotAsymmetryByLogValueTest_WS");
+    alg.setPropertyValue("LogValue", "Field_Danfysik");
+    alg.setPropertyValue("Red", "2");
+    alg.setPropertyValue("Green", "1");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    MatrixWorkspace_sptr fieldWS = boost::dynamic_pointer_cast<MatrixWorkspace>(
+        AnalysisDataService::Instance().retrieve(
+            "PlotAsymmetryByLogValueTest_WS"));
+
+    // The processed runs are reused, which must not change the asymmetry
+    alg.setPropertyValue("LogValue", "run_number");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    MatrixWorkspace_sptr runWS = boost::dynamic_pointer_cast<MatrixWorkspace>(
+        AnalysisDataService::Instance().retrieve(
+            "PlotAsymmetryByLogValueTest_WS"));
+
+    TS_ASSERT(fieldWS);
+    TS_ASSERT(runWS);
+    TS_ASSERT_EQUALS(runWS->getNumberHistograms(), 4);
+    TS_ASSERT_DELTA(runWS->x(0)[0], 15189.0, 1.e-7);
+    TS_ASSERT_DELTA(runWS->x(0)[1], 15190.0, 1.e-7);
+    for (size_t i = 0; i < runWS->getNumberHistograms(); i++) {
+      TS_ASSERT_EQUALS(runWS->y(i).rawData(), fieldWS->y(i).rawData());
+      TS_ASSERT_EQUALS(runWS->e(i).rawData(), fieldWS->e(i).rawData());
+    }
+  }
+
+  void test_disabled_cache_gives_same_asymmetry() {
+    auto &config = Mantid::Kernel::ConfigService::Instance();
+    const std::string key = "plotasymmetrybylogvalue.cache.mb";
+    const auto cacheSize = config.getString(key);
+
+    PlotAsymmetryByLogValue alg;
+    alg.initialize();
+    alg.setPropertyValue("FirstRun", firstRun);
+    alg.setPropertyValue("LastRun", lastRun);
+    alg.setPropertyValue("OutputWorkspace", "PlotAsymmetryByLogValueTest_WS");
+    alg.setPropertyValue("LogValue", "Field_Danfysik");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    MatrixWorkspace_sptr cachedWS =
+        AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(
+            "PlotAsymmetryByLogValueTest_WS");
+
+    config.setString(key, "0");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    config.setString(key, cacheSize);
+    MatrixWorkspace_sptr loadedWS =
+        AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(
+            "PlotAsymmetryByLogValueTest_WS");
+
+    TS_ASSERT(cachedWS);
+    TS_ASSERT(loadedWS);
+    TS_ASSERT_EQUALS(loadedWS->y(0).rawData(), cachedWS->y(0).rawData());
+    TS_ASSERT_EQUALS(loadedWS->e(0).rawData(), cachedWS->e(0).rawData());
+  }
+
 private:
   std::string firstRun, lastRun;
 };
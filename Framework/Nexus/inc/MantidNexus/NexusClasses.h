@@ -15,6 +15,7 @@
 #include "MantidKernel/TimeSeriesProperty.h"
 #include <nexus/napi.h>
 
+#include <algorithm>
 #include <boost/shared_array.hpp>
 #include <boost/shared_ptr.hpp>
 #include <map>
@@ -422,6 +423,29 @@ public:
     alloc(n);
     getSlab(m_data.get(), start, m_size);
   }
+  /** Load a block of a rank 3 dataset that spans several of its leading
+   *  indices in a single read, i.e. the slab [i, i + ni) x [j, j + m) x
+   *  [0, dim2()), where m is blocksize truncated at the end of dim1().
+   *   @param blocksize :: The number of indices to read along dim1()
+   *   @param i :: The first index along dim0()
+   *   @param ni :: The number of indices to read along dim0()
+   *   @param j :: The first index along dim1()
+   */
+  void loadBlock(const int blocksize, int i, int ni, int j) {
+    if (rank() != 3)
+      throw std::runtime_error("A block can only be loaded from a rank 3 "
+                               "dataset: " +
+                               path());
+    if (i < 0 || ni <= 0 || i + ni > dim0() || j < 0 || j >= dim1())
+      rangeError();
+    const int m = std::min(blocksize, dim1() - j);
+    int start[4] = {i, j, 0, 0};
+    m_size[0] = ni;
+    m_size[1] = m;
+    m_size[2] = dim2();
+    alloc(ni * m * dim2());
+    getSlab(m_data.get(), start, m_size);
+  }
 
 private:
   /** Allocates memory for the data buffer
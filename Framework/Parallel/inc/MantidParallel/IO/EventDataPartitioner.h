@@ -9,8 +9,11 @@
 #include "MantidParallel/DllConfig.h"
 #include "MantidParallel/IO/Chunker.h"
 #include "MantidParallel/IO/PulseTimeGenerator.h"
+#include "MantidParallel/IO/SpectrumPartitioning.h"
 #include "MantidTypes/Core/DateAndTime.h"
 
+#include <memory>
+
 namespace Mantid {
 namespace Parallel {
 namespace IO {
@@ -18,8 +21,9 @@ namespace IO {
 /** Partition the event_time_offset and event_id entries and combine them with
   pulse time information obtained from PulseTimeGenerator. Partitioning is to
   obtain a separate vector of events for each rank in an MPI run of Mantid,
-  i.e., each event_id is assigned to a specific MPI rank. Currently a
-  round-robin partitioning scheme is hard-coded.
+  i.e., each event_id is assigned to a specific MPI rank. By default a
+  round-robin partitioning scheme is used, an explicit SpectrumPartitioning can
+  be set to match the partitioning of the target workspace.
 
   @author Simon Heybrock
   @date 2017
@@ -30,6 +34,28 @@ template <class TimeOffsetType> struct Event {
   TimeOffsetType tof;
   Types::Core::DateAndTime pulseTime;
 };
+
+/// Maps a global spectrum index to its partition and local index.
+struct RoundRobinMapping {
+  int partition(const int32_t globalIndex) const {
+    return globalIndex % workers;
+  }
+  int32_t index(const int32_t globalIndex) const {
+    return globalIndex / workers;
+  }
+  const int workers;
+};
+
+/// Maps a global spectrum index to its partition and local index.
+struct TableMapping {
+  int partition(const int32_t globalIndex) const {
+    return table.partition[globalIndex];
+  }
+  int32_t index(const int32_t globalIndex) const {
+    return table.localIndex[globalIndex];
+  }
+  const SpectrumPartitioning &table;
+};
 } // namespace detail
 
 template <class TimeOffsetType> class AbstractEventDataPartitioner {
@@ -54,8 +80,15 @@ public:
   virtual Types::Core::DateAndTime next() = 0;
   virtual void setEventOffset(const size_t event) = 0;
 
+  /// Use the given partitioning instead of round-robin, nullptr resets.
+  void setSpectrumPartitioning(
+      std::shared_ptr<const SpectrumPartitioning> partitioning) {
+    m_spectrumPartitioning = std::move(partitioning);
+  }
+
 protected:
   const int m_numWorkers;
+  std::shared_ptr<const SpectrumPartitioning> m_spectrumPartitioning;
 };
 
 template <class IndexType, class TimeZeroType, class TimeOffsetType>
@@ -79,6 +112,12 @@ public:
   };
 
 private:
+  template <class Mapping>
+  void doPartition(std::vector<std::vector<Event>> &partitioned,
+                   const int32_t *globalSpectrumIndex,
+                   const TimeOffsetType *eventTimeOffset,
+                   const Chunker::LoadRange &range, const Mapping &mapping);
+
   PulseTimeGenerator<IndexType, TimeZeroType> m_pulseTimes;
 };
 
@@ -93,13 +132,38 @@ void EventDataPartitioner<IndexType, TimeZeroType, TimeOffsetType>::partition(
       AbstractEventDataPartitioner<TimeOffsetType>::m_numWorkers;
   partitioned.resize(workers);
 
+  // The mapping is a template argument such that the choice is made once per
+  // chunk, not once per event.
+  const auto &table =
+      AbstractEventDataPartitioner<TimeOffsetType>::m_spectrumPartitioning;
+  if (table)
+    doPartition(partitioned, globalSpectrumIndex, eventTimeOffset, range,
+                detail::TableMapping{*table});
+  else
+    doPartition(partitioned, globalSpectrumIndex, eventTimeOffset, range,
+                detail::RoundRobinMapping{workers});
+}
+
+template <class IndexType, class TimeZeroType, class TimeOffsetType>
+template <class Mapping>
+void EventDataPartitioner<IndexType, TimeZeroType, TimeOffsetType>::doPartition(
+    std::vector<std::vector<Event>> &partitioned,
+    const int32_t *globalSpectrumIndex, const TimeOffsetType *eventTimeOffset,
+    const Chunker::LoadRange &range, const Mapping &mapping) {
   m_pulseTimes.seek(range.eventOffset);
-  for (size_t event = 0; event < range.eventCount; ++event) {
-    // Currently this supports only a hard-coded round-robin partitioning.
-    int partition = globalSpectrumIndex[event] % workers;
-    auto index = globalSpectrumIndex[event] / workers;
-    partitioned[partition].emplace_back(detail::Event<TimeOffsetType>{
-        index, eventTimeOffset[event], m_pulseTimes.next()});
+  size_t event = 0;
+  while (event < range.eventCount) {
+    // All events of a pulse share the pulse time, so it is looked up once per
+    // pulse and the inner loop is free of pulse boundary checks.
+    const auto pulse = m_pulseTimes.nextPulse(range.eventCount - event);
+    const auto pulseTime = pulse.first;
+    const auto end = event + pulse.second;
+    for (; event < end; ++event) {
+      const auto globalIndex = globalSpectrumIndex[event];
+      partitioned[mapping.partition(globalIndex)].emplace_back(
+          detail::Event<TimeOffsetType>{mapping.index(globalIndex),
+                                        eventTimeOffset[event], pulseTime});
+    }
   }
 }
 
@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #pragma once
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -21,6 +22,7 @@ class TofEvent;
 namespace Parallel {
 class Communicator;
 namespace IO {
+struct SpectrumPartitioning;
 
 /** Loader for event data from Nexus files with parallelism based on multiple
   processes (MPI) for performance.
@@ -37,7 +39,8 @@ MANTID_PARALLEL_DLL void
 load(const Communicator &communicator, const std::string &filename,
      const std::string &groupName, const std::vector<std::string> &bankNames,
      const std::vector<int32_t> &bankOffsets,
-     std::vector<std::vector<Types::Event::TofEvent> *> eventLists);
+     std::vector<std::vector<Types::Event::TofEvent> *> eventLists,
+     std::shared_ptr<const SpectrumPartitioning> partitioning = nullptr);
 
 MANTID_PARALLEL_DLL void
 load(const std::string &filename, const std::string &groupName,
@@ -62,8 +62,10 @@ void load(const Chunker &chunker, NXEventDataSource<TimeOffsetType> &dataSource,
                            range.eventCount);
     dataSource.readEventTimeOffset(event_time_offset.data() + bufferOffset,
                                    range.eventOffset, range.eventCount);
+    // Only the input buffers must be free, the previous chunk may still be
+    // appended to the event lists while the next one is parsed.
     if (previousBank != -1)
-      dataSink.wait();
+      dataSink.waitForInputBuffers();
     if (static_cast<int64_t>(range.bankIndex) != previousBank) {
       dataSink.setEventDataPartitioner(std::move(partitioner));
       dataSink.setEventTimeOffsetUnit(dataSource.readEventTimeOffsetUnit());
@@ -79,7 +81,8 @@ template <class TimeOffsetType>
 void load(const Communicator &comm, const H5::Group &group,
           const std::vector<std::string> &bankNames,
           const std::vector<int32_t> &bankOffsets,
-          std::vector<std::vector<Types::Event::TofEvent> *> eventLists) {
+          std::vector<std::vector<Types::Event::TofEvent> *> eventLists,
+          std::shared_ptr<const SpectrumPartitioning> partitioning) {
   // In tests loading from a single SSD this chunk size seems close to the
   // optimum. May need to be adjusted in the future (potentially dynamically)
   // when loading from parallel file systems and running on a cluster.
@@ -93,6 +96,7 @@ void load(const Communicator &comm, const H5::Group &group,
   NXEventDataLoader<TimeOffsetType> loader(comm.size(), group, bankNames);
   EventParser<TimeOffsetType> consumer(comm, chunker.makeWorkerGroups(),
                                        bankOffsets, eventLists);
+  consumer.setSpectrumPartitioning(std::move(partitioning));
   load<TimeOffsetType>(chunker, loader, consumer);
 }
 
@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <numeric>
 #include <thread>
+#include <utility>
 #include <vector>
 #include <xmmintrin.h>
 
@@ -51,12 +52,15 @@ public:
   void setEventDataPartitioner(
       std::unique_ptr<AbstractEventDataPartitioner<TimeOffsetType>>
           partitioner);
+  void setSpectrumPartitioning(
+      std::shared_ptr<const SpectrumPartitioning> partitioning);
   void setEventTimeOffsetUnit(const std::string &unit);
 
   void startAsync(int32_t *event_id_start,
                   const TimeOffsetType *event_time_offset_start,
                   const Chunker::LoadRange &range);
 
+  void waitForInputBuffers();
   void wait();
 
 private:
@@ -65,7 +69,7 @@ private:
                  const Chunker::LoadRange &range);
 
   void redistributeDataMPI();
-  void populateEventLists();
+  void populateEventLists(const double timeOffsetScale);
 
   // Default to 0 such that failure to set unit is easily detected.
   double m_timeOffsetScale{0.0};
@@ -74,9 +78,14 @@ private:
   std::vector<int32_t> m_bankOffsets;
   std::vector<std::vector<Types::Event::TofEvent> *> m_eventLists;
   std::unique_ptr<AbstractEventDataPartitioner<TimeOffsetType>> m_partitioner;
+  std::shared_ptr<const SpectrumPartitioning> m_spectrumPartitioning;
+  std::vector<std::vector<Event>> m_partitionedData;
   std::vector<std::vector<Event>> m_allRankData;
   std::vector<Event> m_thisRankData;
+  /// Converts and partitions the chunk in the input buffers.
   std::thread m_thread;
+  /// Redistributes and appends the previously partitioned chunk.
+  std::thread m_populateThread;
 };
 
 /** Constructor for EventParser.
@@ -109,6 +118,20 @@ void EventParser<TimeOffsetType>::setEventDataPartitioner(
   // the need of having IndexType and TimeZeroType as templates for the whole
   // class.
   m_partitioner = std::move(partitioner);
+  if (m_partitioner)
+    m_partitioner->setSpectrumPartitioning(m_spectrumPartitioning);
+}
+
+/** Set the mapping from global spectrum index to rank and local index.
+ *
+ * Must match the partitioning of the workspace owning the event lists. If not
+ * set, spectra are assumed to be partitioned in a round-robin manner. */
+template <class TimeOffsetType>
+void EventParser<TimeOffsetType>::setSpectrumPartitioning(
+    std::shared_ptr<const SpectrumPartitioning> partitioning) {
+  m_spectrumPartitioning = std::move(partitioning);
+  if (m_partitioner)
+    m_partitioner->setSpectrumPartitioning(m_spectrumPartitioning);
 }
 
 /** Set the unit of the values in `event_time_offset`.
@@ -184,12 +207,14 @@ void EventParser<TimeOffsetType>::redistributeDataMPI() {
   Parallel::wait_all(recv_requests.begin(), recv_requests.end());
 }
 
-/// Append events in m_thisRankData to m_eventLists.
+/// Append events in m_thisRankData to m_eventLists. The scale is passed in
+/// since the unit may already have been changed for the next bank.
 template <class TimeOffsetType>
-void EventParser<TimeOffsetType>::populateEventLists() {
+void EventParser<TimeOffsetType>::populateEventLists(
+    const double timeOffsetScale) {
   for (const auto &event : m_thisRankData) {
     m_eventLists[event.index]->emplace_back(
-        m_timeOffsetScale * static_cast<double>(event.tof), event.pulseTime);
+        timeOffsetScale * static_cast<double>(event.tof), event.pulseTime);
     // In general `index` is random so this loop suffers from frequent cache
     // misses (probably because the hardware prefetchers cannot keep up with the
     // number of different memory locations that are getting accessed). We
@@ -203,8 +228,13 @@ void EventParser<TimeOffsetType>::populateEventLists() {
 /** Accepts raw data from file which has been pre-treated and sorted into chunks
  * for parsing. The parser extracts event data from the provided buffers,
  * separates then according to MPI ranks and then appends them to the workspace
- * event list. Asynchronously starts parsing wait() must be called before
- * attempting to invoke this method subsequently.
+ * event list. Asynchronously starts parsing, waitForInputBuffers() or wait()
+ * must be called before attempting to invoke this method subsequently.
+ *
+ * Parsing is pipelined in two stages: while the events of this chunk are
+ * converted and partitioned, the previous chunk may still be redistributed and
+ * appended to the event lists. Chunks pass through both stages in order, so
+ * pulse time ordering is preserved.
  * @param event_id_start Buffer containing event IDs.
  * @param event_time_offset_start Buffer containing TOD.
  * @param range contains information on the detector bank which corresponds to
@@ -232,15 +262,33 @@ void EventParser<TimeOffsetType>::doParsing(
                                        m_bankOffsets[range.bankIndex]);
 
   // event_id_start now contains globalSpectrumIndex
-  m_partitioner->partition(m_allRankData, event_id_start,
+  m_partitioner->partition(m_partitionedData, event_id_start,
                            event_time_offset_start, range);
 
-  redistributeDataMPI();
-  populateEventLists();
+  // The previous chunk must be appended first to keep events in order.
+  if (m_populateThread.joinable())
+    m_populateThread.join();
+  std::swap(m_partitionedData, m_allRankData);
+  m_populateThread = std::thread([this, timeOffsetScale = m_timeOffsetScale] {
+    redistributeDataMPI();
+    populateEventLists(timeOffsetScale);
+  });
+}
+
+/** Wait until the buffers passed to the last call of startAsync() are no longer
+ * used, i.e., they can be refilled with the next chunk. Appending the events to
+ * the event lists may still be in progress. */
+template <class TimeOffsetType>
+void EventParser<TimeOffsetType>::waitForInputBuffers() {
+  if (m_thread.joinable())
+    m_thread.join();
 }
 
+/// Wait until all chunks passed to startAsync() have been fully parsed.
 template <class TimeOffsetType> void EventParser<TimeOffsetType>::wait() {
-  m_thread.join();
+  waitForInputBuffers();
+  if (m_populateThread.joinable())
+    m_populateThread.join();
 }
 
 } // namespace IO
@@ -93,6 +93,10 @@ private:
 
   size_t estimateShmemAmount(size_t eventCount) const;
 
+  const Chunks &findChunks(ip::managed_shared_memory &segment,
+                           const std::string &name) const;
+  template <class Func> void forEachPixelBlock(const Func &func) const;
+
 private:
   bool m_precalculateEvents;
   uint32_t m_numPixels;
@@ -9,6 +9,9 @@
 #include "MantidParallel/DllConfig.h"
 #include "MantidTypes/Core/DateAndTime.h"
 
+#include <algorithm>
+#include <utility>
+
 namespace Mantid {
 namespace Parallel {
 namespace IO {
@@ -100,6 +103,21 @@ public:
     return m_pulseTime;
   }
 
+  /** Return pulse time for next event together with the number of consecutive
+   * events (at most `maxCount`) sharing that pulse time, and advance past all
+   * of them. This lets callers assign pulse times in tight per-pulse loops
+   * instead of checking for a pulse boundary at every event. Must call seek()
+   * first, at least once. */
+  std::pair<Types::Core::DateAndTime, size_t> nextPulse(const size_t maxCount) {
+    const auto pulseTime = next();
+    size_t count = maxCount;
+    if (m_pulse < m_index.size() - 1)
+      count = std::min(
+          count, static_cast<size_t>(m_index[m_pulse + 1] - m_event) + 1);
+    m_event += static_cast<IndexType>(count - 1);
+    return {pulseTime, count};
+  }
+
 private:
   Types::Core::DateAndTime getPulseTime(const Types::Core::DateAndTime &offset,
                                         const TimeZeroType &eventTimeZero) {
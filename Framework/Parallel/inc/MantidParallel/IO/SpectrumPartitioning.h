@@ -0,0 +1,31 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Mantid {
+namespace Parallel {
+namespace IO {
+
+/** Explicit mapping of every global spectrum index to the partition (MPI rank)
+  holding it and to the index of the spectrum on that partition.
+
+  Used by the event loader to partition events in the same way as the
+  workspace they are loaded into, e.g., when the workspace partitioning is
+  balancing event counts rather than using the default round-robin scheme.
+  Both vectors are indexed by global spectrum index.
+*/
+struct SpectrumPartitioning {
+  std::vector<int> partition;
+  std::vector<int32_t> localIndex;
+};
+
+} // namespace IO
+} // namespace Parallel
+} // namespace Mantid
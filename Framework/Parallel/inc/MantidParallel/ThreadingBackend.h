@@ -13,30 +13,53 @@
 #include <boost/archive/binary_iarchive.hpp>
 #include <boost/archive/binary_oarchive.hpp>
 
-#include <chrono>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <istream>
-#include <map>
+#include <memory>
 #include <mutex>
 #include <ostream>
 #include <sstream>
-#include <tuple>
+#include <stdexcept>
+#include <type_traits>
+#include <typeinfo>
 #include <vector>
 
 namespace Mantid {
 namespace Parallel {
 namespace detail {
 
+namespace detail {
+/** A message in transit between two ranks. Trivially copyable data is kept as
+  a std::vector of its element type, which the receiver takes over without a
+  further copy where it can. Data of any other type is serialized. */
+struct Message {
+  int tag{0};
+  /// Trivially copyable payload, a std::vector<T> with T given by type
+  std::shared_ptr<void> data;
+  const std::type_info *type{nullptr};
+  /// Serialized payload of any other type
+  std::unique_ptr<std::stringbuf> archive;
+};
+} // namespace detail
+
 /** ThreadingBackend provides a backend for data exchange between Communicators
   in the case of non-MPI builds when communication between threads is used to
-  mimic MPI calls. This is FOR UNIT TESTING ONLY and is NOT FOR PRODUCTION CODE.
+  mimic MPI calls.
+
+  Messages are queued in a mailbox for each pair of source and destination
+  rank, each with its own lock, so ranks that do not talk to each other never
+  contend. Trivially copyable values, std::vectors and arrays of them are passed
+  on without serialization, other types go through boost::archive.
 
   @author Simon Heybrock
   @date 2017
 */
 class MANTID_PARALLEL_DLL ThreadingBackend {
 public:
-  ThreadingBackend() = default;
+  ThreadingBackend();
   explicit ThreadingBackend(const int size);
 
   ThreadingBackend(const ThreadingBackend &) = delete;
@@ -58,11 +81,19 @@ public:
   Request irecv(int dest, int source, int tag, T *data, const size_t count);
 
 private:
-  int m_size{1};
-  std::map<std::tuple<int, int, int>,
-           std::vector<std::unique_ptr<std::stringbuf>>>
-      m_buffer;
-  std::mutex m_mutex;
+  /// The messages sent from one rank to another, in the order they were sent
+  struct Mailbox {
+    std::mutex mutex;
+    std::condition_variable arrived;
+    std::deque<detail::Message> messages;
+  };
+
+  Mailbox &mailbox(int source, int dest);
+  void post(int source, int dest, detail::Message message);
+  detail::Message take(int dest, int source, int tag);
+
+  int m_size;
+  std::vector<Mailbox> m_mailboxes;
 };
 
 namespace detail {
@@ -105,14 +136,14 @@ size_t loadFromStream(boost::archive::binary_iarchive &ia, T *data,
   }
   return count * sizeof(T);
 }
-} // namespace detail
 
-template <typename... T>
-void ThreadingBackend::send(int source, int dest, int tag, T &&... args) {
+template <class T> using IsTrivial = std::is_trivially_copyable<T>;
+
+template <class... T> void serialize(Message &message, T &&... args) {
   // Must wrap std::stringbuf in a unique_ptr since gcc on RHEL7 does not
   // support moving a stringbuf (incomplete C++11 support?).
-  auto buf = std::make_unique<std::stringbuf>();
-  std::ostream os(buf.get());
+  message.archive = std::make_unique<std::stringbuf>();
+  std::ostream os(message.archive.get());
   {
     // The binary_oarchive must be scoped to prevent a segmentation fault. I
     // believe the reason is that otherwise recv() may end up reading from the
@@ -120,34 +151,126 @@ void ThreadingBackend::send(int source, int dest, int tag, T &&... args) {
     // though, since it is *not* writing to the buffer, somehow the oarchive
     // destructor must be doing something that requires the buffer.
     boost::archive::binary_oarchive oa(os);
-    detail::saveToStream(oa, std::forward<T>(args)...);
+    saveToStream(oa, std::forward<T>(args)...);
   }
-  std::lock_guard<std::mutex> lock(m_mutex);
-  m_buffer[std::make_tuple(source, dest, tag)].emplace_back(std::move(buf));
+}
+
+template <class... T> size_t deserialize(Message &message, T &&... args) {
+  if (!message.archive)
+    throw std::runtime_error("ThreadingBackend: received a message of a "
+                             "different type than the one that was sent.");
+  std::istream is(message.archive.get());
+  boost::archive::binary_iarchive ia(is);
+  return loadFromStream(ia, std::forward<T>(args)...);
+}
+
+template <class T> void setPayload(Message &message, std::vector<T> data) {
+  message.type = &typeid(T);
+  message.data = std::make_shared<std::vector<T>>(std::move(data));
+}
+
+template <class T> std::vector<T> &payload(Message &message) {
+  if (!message.data || *message.type != typeid(T))
+    throw std::runtime_error("ThreadingBackend: received a message of a "
+                             "different type than the one that was sent.");
+  return *static_cast<std::vector<T> *>(message.data.get());
+}
+
+template <class T>
+void pack(Message &message, const T &data, std::true_type) {
+  setPayload(message, std::vector<T>{data});
+}
+template <class T>
+void pack(Message &message, const T &data, std::false_type) {
+  serialize(message, data);
+}
+template <class T>
+void pack(Message &message, const std::vector<T> &data, std::true_type) {
+  setPayload(message, data);
+}
+template <class T>
+void pack(Message &message, const std::vector<T> &data, std::false_type) {
+  serialize(message, data);
+}
+template <class T>
+void pack(Message &message, const T *data, const size_t count,
+          std::true_type) {
+  setPayload(message, std::vector<T>(data, data + count));
+}
+template <class T>
+void pack(Message &message, const T *data, const size_t count,
+          std::false_type) {
+  serialize(message, data, count);
+}
+
+template <class T> void pack(Message &message, const T &data) {
+  pack(message, data, IsTrivial<T>());
+}
+template <class T> void pack(Message &message, const std::vector<T> &data) {
+  pack(message, data, IsTrivial<T>());
+}
+template <class T>
+void pack(Message &message, const T *data, const size_t count) {
+  pack(message, data, count, IsTrivial<T>());
+}
+
+template <class T> size_t unpack(Message &message, T &data, std::true_type) {
+  const auto &values = payload<T>(message);
+  if (!values.empty())
+    data = values.front();
+  return sizeof(T);
+}
+template <class T> size_t unpack(Message &message, T &data, std::false_type) {
+  return deserialize(message, data);
+}
+template <class T>
+size_t unpack(Message &message, std::vector<T> &data, std::true_type) {
+  // The message is not shared, so its vector can be handed over.
+  data = std::move(payload<T>(message));
+  return data.size() * sizeof(T);
+}
+template <class T>
+size_t unpack(Message &message, std::vector<T> &data, std::false_type) {
+  return deserialize(message, data);
+}
+template <class T>
+size_t unpack(Message &message, T *data, const size_t count,
+              std::true_type) {
+  const auto &values = payload<T>(message);
+  const auto received = std::min(count, values.size());
+  std::copy_n(values.begin(), received, data);
+  return received * sizeof(T);
+}
+template <class T>
+size_t unpack(Message &message, T *data, const size_t count,
+              std::false_type) {
+  return deserialize(message, data, count);
+}
+
+template <class T> size_t unpack(Message &message, T &data) {
+  return unpack(message, data, IsTrivial<T>());
+}
+template <class T> size_t unpack(Message &message, std::vector<T> &data) {
+  return unpack(message, data, IsTrivial<T>());
+}
+template <class T>
+size_t unpack(Message &message, T *data, const size_t count) {
+  return unpack(message, data, count, IsTrivial<T>());
+}
+} // namespace detail
+
+template <typename... T>
+void ThreadingBackend::send(int source, int dest, int tag, T &&... args) {
+  detail::Message message;
+  message.tag = tag;
+  detail::pack(message, std::forward<T>(args)...);
+  post(source, dest, std::move(message));
 }
 
 template <typename... T>
 Status ThreadingBackend::recv(int dest, int source, int tag, T &&... args) {
-  const auto key = std::make_tuple(source, dest, tag);
-  std::unique_ptr<std::stringbuf> buf;
-  while (true) {
-    // Sleep to reduce lock contention. Without this execution times can grow
-    // enormously on Windows.
-    std::this_thread::sleep_for(std::chrono::microseconds(10));
-    std::lock_guard<std::mutex> lock(m_mutex);
-    auto it = m_buffer.find(key);
-    if (it == m_buffer.end())
-      continue;
-    auto &queue = it->second;
-    if (queue.empty())
-      continue;
-    buf = std::move(queue.front());
-    queue.erase(queue.begin());
-    break;
-  }
-  std::istream is(buf.get());
-  boost::archive::binary_iarchive ia(is);
-  return Status(detail::loadFromStream(ia, std::forward<T>(args)...));
+  auto message = take(dest, source, tag);
+  return Status(detail::unpack(message, std::forward<T>(args)...));
 }
 
 template <typename... T>
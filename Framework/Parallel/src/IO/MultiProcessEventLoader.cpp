@@ -192,43 +192,68 @@ void MultiProcessEventLoader::load(
   }
 }
 
-/**Collects data from the chunks in shared memory to the final structure*/
+/**Collects data from the chunks in shared memory to the final structure.
+ * The events of each pixel are counted over all segments first, such that
+ * every list is sized exactly once. The events are then copied segment by
+ * segment, and each segment is removed as soon as it has been copied, so at
+ * most one segment is kept alive in addition to the assembled lists.*/
 void MultiProcessEventLoader::assembleFromShared(
     std::vector<std::vector<Mantid::Types::Event::TofEvent> *> &result) const {
-  std::vector<std::thread> workers;
+  std::vector<std::size_t> sizes(m_numPixels, 0);
+  for (const auto &name : m_segmentNames) {
+    ip::managed_shared_memory segment{ip::open_read_only, name.c_str()};
+    const auto &chunks = findChunks(segment, name);
+    forEachPixelBlock([&](uint32_t pixel) {
+      for (const auto &ch : chunks)
+        sizes[pixel] += ch[pixel].size();
+    });
+  }
+  forEachPixelBlock([&](uint32_t pixel) {
+    auto &res = *result[pixel];
+    res.reserve(res.size() + sizes[pixel]);
+  });
+
+  for (const auto &name : m_segmentNames) {
+    {
+      ip::managed_shared_memory segment{ip::open_read_only, name.c_str()};
+      const auto &chunks = findChunks(segment, name);
+      forEachPixelBlock([&](uint32_t pixel) {
+        auto &res = *result[pixel];
+        for (const auto &ch : chunks)
+          res.insert(res.end(), ch[pixel].begin(), ch[pixel].end());
+      });
+    }
+    ip::shared_memory_object::remove(name.c_str());
+  }
+}
 
-  std::vector<std::atomic<uint32_t>> cnts(m_segmentNames.size());
-  std::fill(cnts.begin(), cnts.end(), 0);
-  std::vector<std::atomic<uint32_t>> processCounter(m_segmentNames.size());
-  std::fill(processCounter.begin(), processCounter.end(), 0);
+/// Returns the event chunks stored in the given shared memory segment.
+const Chunks &
+MultiProcessEventLoader::findChunks(ip::managed_shared_memory &segment,
+                                    const std::string &name) const {
+  const auto chunks = segment.find<Chunks>(m_storageName.c_str()).first;
+  if (!chunks)
+    throw std::runtime_error("No event lists found in shared memory "
+                             "segment " +
+                             name);
+  return *chunks;
+}
 
+/// Calls `func` for every pixel, distributing blocks of pixels dynamically
+/// over m_numThreads workers.
+template <class Func>
+void MultiProcessEventLoader::forEachPixelBlock(const Func &func) const {
+  std::atomic<uint32_t> cnt{0};
   const unsigned portion{std::max<unsigned>(m_numPixels / m_numThreads / 3, 1)};
 
+  std::vector<std::thread> workers;
   for (unsigned i = 0; i < m_numThreads; ++i) {
     workers.emplace_back([&]() {
-      for (std::size_t segId = 0; segId < m_segmentNames.size(); ++segId) {
-        ip::managed_shared_memory segment{ip::open_read_only,
-                                          m_segmentNames[segId].c_str()};
-        auto chunks =
-            segment.find<Mantid::Parallel::IO::Chunks>(m_storageName.c_str())
-                .first;
-        auto &cnt = cnts[segId];
-        for (uint32_t startPixel = cnt.fetch_add(portion);
-             startPixel < m_numPixels; startPixel = cnt.fetch_add(portion)) {
-          auto toPixel = std::min(startPixel + portion, m_numPixels);
-          for (uint32_t pixel = startPixel; pixel < toPixel; ++pixel) {
-            auto &res = result[pixel];
-            for (auto &ch : *chunks) {
-              res->insert(res->end(), ch[pixel].begin(), ch[pixel].end());
-            }
-          }
-        }
-        ++processCounter[segId];
-        if (processCounter[segId] == m_numThreads)
-          ip::shared_memory_object::remove(m_segmentNames[segId].c_str());
-
-        while (processCounter[segId] != m_numThreads)
-          ;
+      for (uint32_t startPixel = cnt.fetch_add(portion);
+           startPixel < m_numPixels; startPixel = cnt.fetch_add(portion)) {
+        auto toPixel = std::min(startPixel + portion, m_numPixels);
+        for (uint32_t pixel = startPixel; pixel < toPixel; ++pixel)
+          func(pixel);
       }
     });
   }
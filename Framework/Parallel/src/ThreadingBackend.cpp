@@ -10,10 +10,48 @@ namespace Mantid {
 namespace Parallel {
 namespace detail {
 
-ThreadingBackend::ThreadingBackend(const int size) : m_size(size) {}
+ThreadingBackend::ThreadingBackend() : ThreadingBackend(1) {}
+
+ThreadingBackend::ThreadingBackend(const int size)
+    : m_size(size), m_mailboxes(static_cast<size_t>(size) * size) {}
 
 int ThreadingBackend::size() const { return m_size; }
 
+/// Returns the mailbox for messages from rank source to rank dest.
+ThreadingBackend::Mailbox &ThreadingBackend::mailbox(int source, int dest) {
+  if (source < 0 || source >= m_size || dest < 0 || dest >= m_size)
+    throw std::out_of_range("ThreadingBackend: rank out of range.");
+  return m_mailboxes[static_cast<size_t>(source) * m_size + dest];
+}
+
+/// Queues a message for rank dest and wakes up any rank waiting for it.
+void ThreadingBackend::post(int source, int dest, detail::Message message) {
+  auto &box = mailbox(source, dest);
+  {
+    std::lock_guard<std::mutex> lock(box.mutex);
+    box.messages.emplace_back(std::move(message));
+  }
+  box.arrived.notify_all();
+}
+
+/** Removes the oldest message with the given tag sent from rank source to rank
+ * dest, waiting for it to arrive if necessary.
+ */
+detail::Message ThreadingBackend::take(int dest, int source, int tag) {
+  auto &box = mailbox(source, dest);
+  std::unique_lock<std::mutex> lock(box.mutex);
+  auto match = box.messages.end();
+  box.arrived.wait(lock, [&box, &match, tag]() {
+    match = std::find_if(
+        box.messages.begin(), box.messages.end(),
+        [tag](const detail::Message &message) { return message.tag == tag; });
+    return match != box.messages.end();
+  });
+  auto message = std::move(*match);
+  box.messages.erase(match);
+  return message;
+}
+
 } // namespace detail
 } // namespace Parallel
 } // namespace Mantid
@@ -134,4 +134,31 @@ public:
     TS_ASSERT_EQUALS(data[1][1], (Event{1, 3.3, DateAndTime(8)}));
     TS_ASSERT_EQUALS(data[1][2], (Event{0, 4.4, DateAndTime(8)}));
   }
+
+  void test_partition_with_spectrum_partitioning() {
+    EventDataPartitioner<int32_t, int64_t, double> partitioner(
+        2, PulseTimeGenerator<int32_t, int64_t>({0, 2, 2, 3}, {2, 4, 6, 8},
+                                                "nanosecond", 0));
+    // Spectra 0, 1 and 5 on worker 0, the others on worker 1.
+    auto partitioning = std::make_shared<SpectrumPartitioning>();
+    partitioning->partition = {0, 0, 1, 1, 1, 0};
+    partitioning->localIndex = {0, 1, 0, 1, 2, 2};
+    partitioner.setSpectrumPartitioning(partitioning);
+    std::vector<std::vector<Event>> data;
+    std::vector<int32_t> index{5, 1, 4, 1};
+    std::vector<double> tof{1.1, 2.2, 3.3, 4.4};
+    partitioner.partition(data, index.data(), tof.data(), {0, 0, 4});
+    TS_ASSERT_EQUALS(data.size(), 2);
+    TS_ASSERT_EQUALS(data[0].size(), 3);
+    TS_ASSERT_EQUALS(data[1].size(), 1);
+    TS_ASSERT_EQUALS(data[0][0], (Event{2, 1.1, DateAndTime(2)}));
+    TS_ASSERT_EQUALS(data[0][1], (Event{1, 2.2, DateAndTime(2)}));
+    TS_ASSERT_EQUALS(data[1][0], (Event{2, 3.3, DateAndTime(6)}));
+    TS_ASSERT_EQUALS(data[0][2], (Event{1, 4.4, DateAndTime(8)}));
+    // Resetting restores round-robin partitioning.
+    partitioner.setSpectrumPartitioning(nullptr);
+    partitioner.partition(data, index.data(), tof.data(), {0, 0, 4});
+    TS_ASSERT_EQUALS(data[0].size(), 1);
+    TS_ASSERT_EQUALS(data[1].size(), 3);
+  }
 };
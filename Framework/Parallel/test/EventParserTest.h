@@ -334,6 +334,51 @@ public:
     gen.checkEventLists();
   }
 
+  void testParsingFull_Pipelined_1Rank_3Banks() {
+    size_t numBanks = 3;
+    anonymous::FakeParserDataGenerator<int32_t, int64_t, double> gen(3, 20, 7);
+    auto parser = gen.generateTestParser();
+
+    std::vector<std::vector<int32_t>> event_ids;
+    std::vector<std::vector<double>> event_time_offsets;
+    for (size_t bank = 0; bank < numBanks; bank++) {
+      event_ids.emplace_back(gen.eventId(bank));
+      event_time_offsets.emplace_back(gen.eventTimeOffset(bank));
+    }
+
+    for (size_t bank = 0; bank < numBanks; bank++) {
+      // Only the input buffers are released between chunks, as in
+      // EventLoader::load, so chunks of different banks overlap.
+      parser->waitForInputBuffers();
+      parser->setEventDataPartitioner(
+          std::make_unique<EventDataPartitioner<int32_t, int64_t, double>>(
+              1, PulseTimeGenerator<int32_t, int64_t>{gen.eventIndex(bank),
+                                                      gen.eventTimeZero(),
+                                                      "nanosecond", 0}));
+      parser->setEventTimeOffsetUnit("microsecond");
+      auto &event_id = event_ids[bank];
+      auto &event_time_offset = event_time_offsets[bank];
+
+      auto parts = 11;
+      auto portion = event_id.size() / parts;
+
+      for (int i = 0; i < parts; ++i) {
+        auto offset = portion * i;
+
+        // Needed so that no data is missed.
+        if (i == (parts - 1))
+          portion = event_id.size() - offset;
+
+        Chunker::LoadRange range{bank, offset, portion};
+        parser->waitForInputBuffers();
+        parser->startAsync(event_id.data() + offset,
+                           event_time_offset.data() + offset, range);
+      }
+    }
+    parser->wait();
+    gen.checkEventLists();
+  }
+
   void test_setEventTimeOffsetUnit() {
     std::vector<std::vector<int>> rankGroups;
     std::vector<int32_t> bankOffsets{0};
@@ -172,6 +172,35 @@ public:
     TS_ASSERT_EQUALS(pulseTimes.next().totalNanoseconds(), 1012);
   }
 
+  void test_nextPulse() {
+    PulseTimeGenerator pulseTimes({0, 2, 2, 3}, {4, 8, 12, 16}, "nanosecond",
+                                  1000);
+    pulseTimes.seek(0);
+    auto pulse = pulseTimes.nextPulse(10);
+    TS_ASSERT_EQUALS(pulse.first.totalNanoseconds(), 1004);
+    TS_ASSERT_EQUALS(pulse.second, 2);
+    // Empty pulse is skipped
+    pulse = pulseTimes.nextPulse(10);
+    TS_ASSERT_EQUALS(pulse.first.totalNanoseconds(), 1012);
+    TS_ASSERT_EQUALS(pulse.second, 1);
+    // Last pulse extends to the requested count
+    pulse = pulseTimes.nextPulse(10);
+    TS_ASSERT_EQUALS(pulse.first.totalNanoseconds(), 1016);
+    TS_ASSERT_EQUALS(pulse.second, 10);
+  }
+
+  void test_nextPulse_limited_by_count() {
+    PulseTimeGenerator pulseTimes({0, 3}, {4, 8}, "nanosecond", 1000);
+    pulseTimes.seek(1);
+    auto pulse = pulseTimes.nextPulse(1);
+    TS_ASSERT_EQUALS(pulse.first.totalNanoseconds(), 1004);
+    TS_ASSERT_EQUALS(pulse.second, 1);
+    pulse = pulseTimes.nextPulse(5);
+    TS_ASSERT_EQUALS(pulse.first.totalNanoseconds(), 1004);
+    TS_ASSERT_EQUALS(pulse.second, 1);
+    TS_ASSERT_EQUALS(pulseTimes.next().totalNanoseconds(), 1008);
+  }
+
   void test_event_time_zero_type_conversion() {
     Mantid::Parallel::IO::PulseTimeGenerator<int32_t, float> pulseTimes(
         {0}, {1.5}, "microsecond", 10000);
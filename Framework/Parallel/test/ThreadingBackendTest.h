@@ -10,6 +10,12 @@
 
 #include "MantidParallel/ThreadingBackend.h"
 
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <string>
+#include <thread>
+
 using Mantid::Parallel::detail::ThreadingBackend;
 
 class ThreadingBackendTest : public CxxTest::TestSuite {
@@ -30,4 +36,70 @@ public:
     ThreadingBackend backend{2};
     TS_ASSERT_EQUALS(backend.size(), 2);
   }
+
+  void test_send_recv_vector() {
+    ThreadingBackend backend{2};
+    const std::vector<double> data{1.0, 2.0, 3.0};
+    backend.send(0, 1, 7, data);
+    std::vector<double> result;
+    const auto status = backend.recv(1, 0, 7, result);
+    TS_ASSERT_EQUALS(result, data);
+    TS_ASSERT_EQUALS(*status.count<double>(), 3);
+  }
+
+  void test_send_recv_array() {
+    ThreadingBackend backend{2};
+    const std::vector<int> data{1, 2};
+    backend.send(1, 0, 0, data.data(), 2);
+    std::vector<int> result(3, 0);
+    const auto status = backend.recv(0, 1, 0, result.data(), 3);
+    TS_ASSERT_EQUALS(result, std::vector<int>({1, 2, 0}));
+    TS_ASSERT_EQUALS(*status.count<int>(), 2);
+  }
+
+  void test_send_recv_serialized_types() {
+    ThreadingBackend backend{2};
+    const std::vector<std::string> data{"a", "bc"};
+    backend.send(0, 1, 0, data);
+    std::vector<std::string> result;
+    backend.recv(1, 0, 0, result);
+    TS_ASSERT_EQUALS(result, data);
+  }
+
+  void test_recv_matches_tag() {
+    ThreadingBackend backend{2};
+    backend.send(0, 1, 1, 1);
+    backend.send(0, 1, 2, 2);
+    backend.send(0, 1, 1, 3);
+    int result{0};
+    backend.recv(1, 0, 2, result);
+    TS_ASSERT_EQUALS(result, 2);
+    backend.recv(1, 0, 1, result);
+    TS_ASSERT_EQUALS(result, 1);
+    backend.recv(1, 0, 1, result);
+    TS_ASSERT_EQUALS(result, 3);
+  }
+
+  void test_recv_waits_for_send() {
+    ThreadingBackend backend{2};
+    std::vector<double> result;
+    std::thread receiver([&backend, &result]() {
+      backend.recv(1, 0, 0, result);
+    });
+    backend.send(0, 1, 0, std::vector<double>{4.0});
+    receiver.join();
+    TS_ASSERT_EQUALS(result, std::vector<double>{4.0});
+  }
+
+  void test_recv_of_different_type_throws() {
+    ThreadingBackend backend{2};
+    backend.send(0, 1, 0, 1.0);
+    int result{0};
+    TS_ASSERT_THROWS(backend.recv(1, 0, 0, result), const std::runtime_error &);
+  }
+
+  void test_rank_out_of_range_throws() {
+    ThreadingBackend backend{2};
+    TS_ASSERT_THROWS(backend.send(0, 2, 0, 1), const std::out_of_range &);
+  }
 };
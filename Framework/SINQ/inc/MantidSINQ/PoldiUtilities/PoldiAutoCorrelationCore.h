@@ -66,6 +66,9 @@ protected:
   double getRawCorrelatedIntensity(double dValue, double weight) const;
   UncertainValue getCMessAndCSigma(double dValue, double slitTimeOffset,
                                    int index) const;
+  UncertainValue getCMessAndCSigma(const CountLocator &locator,
+                                   const double *counts,
+                                   const double *normCounts) const;
   CountLocator getCountLocator(double dValue, double slitTimeOffset,
                                int index) const;
   virtual double
@@ -88,6 +91,7 @@ protected:
 
   void setCountData(const DataObjects::Workspace2D_sptr &countData);
   void setNormCountData(const DataObjects::Workspace2D_sptr &normCountData);
+  void fillCountTables();
 
   double correctedIntensity(double intensity, double weight) const;
   virtual double calculateCorrelationBackground(double sumOfCorrelationCounts,
@@ -114,6 +118,11 @@ protected:
   DataObjects::Workspace2D_sptr m_countData;
   DataObjects::Workspace2D_sptr m_normCountData;
 
+  /* Counts and norm counts of the detector elements in m_detectorElements,
+   * one row of m_timeBinCount values per element. */
+  std::vector<double> m_countTable;
+  std::vector<double> m_normCountTable;
+
   double m_sumOfWeights;
   double m_correlationBackground;
 
@@ -29,9 +29,9 @@ using namespace std::placeholders;
 PoldiAutoCorrelationCore::PoldiAutoCorrelationCore(Kernel::Logger &g_log)
     : m_detector(), m_chopper(), m_wavelengthRange(), m_deltaT(), m_deltaD(),
       m_timeBinCount(), m_detectorElements(), m_weightsForD(),
-      m_tofsFor1Angstrom(), m_countData(), m_normCountData(),
-      m_sumOfWeights(0.0), m_correlationBackground(0.0), m_damp(0.0),
-      m_logger(g_log) {}
+      m_tofsFor1Angstrom(), m_countData(), m_normCountData(), m_countTable(),
+      m_normCountTable(), m_sumOfWeights(0.0), m_correlationBackground(0.0),
+      m_damp(0.0), m_logger(g_log) {}
 
 /** Sets the components POLDI currently consists of. The detector should
  *probably be one with a DeadWireDecorator so dead wires are taken into account
@@ -148,6 +148,13 @@ DataObjects::Workspace2D_sptr PoldiAutoCorrelationCore::calculate(
       m_indices[i] = i;
     }
 
+    /* The correlation sums read the counts of every element once for each
+     * combination of d-value and chopper slit, so they are gathered into
+     * contiguous tables first.
+     */
+    m_logger.information() << "  Collecting counts...\n";
+    fillCountTables();
+
     /* The auto-correlation algorithm works by probing a list of d-Values, which
      * is created at this point. The spacing used is the maximum resolution of
      * the instrument,
@@ -300,10 +307,11 @@ PoldiAutoCorrelationCore::getRawCorrelatedIntensity(double dValue,
    * diffracted by this family of planes with given d.
    */
   try {
+    const std::vector<double> &slitTimes = m_chopper->slitTimes();
     std::vector<UncertainValue> current;
-    current.reserve(m_chopper->slitTimes().size());
+    current.reserve(slitTimes.size());
 
-    for (double slitOffset : m_chopper->slitTimes()) {
+    for (double slitOffset : slitTimes) {
       /* For each offset, the sum of correlation intensity and error (for each
        * detector element)
        * is computed from the counts in the space/time location possible for
@@ -312,14 +320,14 @@ PoldiAutoCorrelationCore::getRawCorrelatedIntensity(double dValue,
        * vector
        * is equal to the number of chopper slits.
        */
-      std::vector<UncertainValue> cmess(m_detector->elementCount());
-      std::transform(m_indices.begin(), m_indices.end(), cmess.begin(),
-                     std::bind(&PoldiAutoCorrelationCore::getCMessAndCSigma,
-                               this, dValue, slitOffset, _1));
-
-      UncertainValue sum =
-          std::accumulate(cmess.begin(), cmess.end(), UncertainValue(0.0, 0.0),
-                          &UncertainValue::plainAddition);
+      UncertainValue sum(0.0, 0.0);
+      for (int index : m_indices) {
+        CountLocator locator = getCountLocator(dValue, slitOffset, index);
+        const size_t row = static_cast<size_t>(index) * m_timeBinCount;
+        sum = UncertainValue::plainAddition(
+            sum, getCMessAndCSigma(locator, &m_countTable[row],
+                                   &m_normCountTable[row]));
+      }
 
       current.emplace_back(sum);
     }
@@ -354,6 +362,27 @@ UncertainValue PoldiAutoCorrelationCore::getCMessAndCSigma(
    */
   CountLocator locator = getCountLocator(dValue, slitTimeOffset, index);
 
+  std::vector<double> counts(m_timeBinCount);
+  std::vector<double> normCounts(m_timeBinCount);
+  for (int t = 0; t < m_timeBinCount; ++t) {
+    counts[t] = getCounts(locator.detectorElement, t);
+    normCounts[t] = getNormCounts(locator.detectorElement, t);
+  }
+
+  return getCMessAndCSigma(locator, counts.data(), normCounts.data());
+}
+
+/** Calculate correlation intensity and error from the counts of a single
+ *detector element at the location described by a count locator
+ *
+ * @param locator :: Location of the counts, as returned by getCountLocator.
+ * @param counts :: Counts of the detector element for each time bin.
+ * @param normCounts :: Norm counts of the detector element for each time bin.
+ * @return Pair of intensity and error for given input.
+ */
+UncertainValue PoldiAutoCorrelationCore::getCMessAndCSigma(
+    const CountLocator &locator, const double *counts,
+    const double *normCounts) const {
   /* In the original fortran program, three cases are considered for the width
    * of the arrival window: 1, 2 and 3 time bins (which corresponds to index
    *differences of
@@ -372,8 +401,8 @@ UncertainValue PoldiAutoCorrelationCore::getCMessAndCSigma(
   double value = 0.0;
   double error = 0.0;
 
-  double minCounts = getCounts(locator.detectorElement, locator.iicmin);
-  double normMinCounts = getNormCounts(locator.detectorElement, locator.iicmin);
+  double minCounts = counts[locator.iicmin];
+  double normMinCounts = normCounts[locator.iicmin];
 
   switch (indexDifference) {
   case 0: {
@@ -386,19 +415,18 @@ UncertainValue PoldiAutoCorrelationCore::getCMessAndCSigma(
 
     if (middleIndex < 0) {
       m_logger.warning() << "Inconsistency foun while calculating correlation "
-                            "intensity and error for d-value: "
-                         << boost::lexical_cast<std::string>(dValue)
-                         << ", with detector index: " << std::to_string(index)
+                            "intensity and error for detector element: "
+                         << std::to_string(locator.detectorElement)
                          << ", got middle index: "
                          << std::to_string(middleIndex) << ", ignoring it.\n";
       break;
     }
 
-    double counts = getCounts(locator.detectorElement, middleIndex);
-    double normCounts = getNormCounts(locator.detectorElement, middleIndex);
+    double middleCounts = counts[middleIndex];
+    double normMiddleCounts = normCounts[middleIndex];
 
-    value = counts * 1.0 / normCounts;
-    error = 1.0 / normCounts;
+    value = middleCounts * 1.0 / normMiddleCounts;
+    error = 1.0 / normMiddleCounts;
   }
   case 1: {
     value += minCounts *
@@ -407,9 +435,8 @@ UncertainValue PoldiAutoCorrelationCore::getCMessAndCSigma(
     error += (static_cast<double>(locator.icmin) - locator.cmin + 1.0) /
              normMinCounts;
 
-    double maxCounts = getCounts(locator.detectorElement, locator.iicmax);
-    double normMaxCounts =
-        getNormCounts(locator.detectorElement, locator.iicmax);
+    double maxCounts = counts[locator.iicmax];
+    double normMaxCounts = normCounts[locator.iicmax];
 
     value += maxCounts * (locator.cmax - static_cast<double>(locator.icmax)) /
              normMaxCounts;
@@ -515,6 +542,28 @@ void PoldiAutoCorrelationCore::setNormCountData(
   m_normCountData = normCountData;
 }
 
+/** Copies counts and norm counts of all detector elements into contiguous
+ *tables, so that the correlation sums do not need to look them up in the
+ *workspaces for every d-value and chopper slit.
+ *
+ * Requires m_detectorElements and m_timeBinCount to be set.
+ */
+void PoldiAutoCorrelationCore::fillCountTables() {
+  const size_t tableSize = m_detectorElements.size() * m_timeBinCount;
+  m_countTable.resize(tableSize);
+  m_normCountTable.resize(tableSize);
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < static_cast<int>(m_detectorElements.size()); ++i) {
+    const int element = m_detectorElements[i];
+    const size_t row = static_cast<size_t>(i) * m_timeBinCount;
+    for (int t = 0; t < m_timeBinCount; ++t) {
+      m_countTable[row + t] = getCounts(element, t);
+      m_normCountTable[row + t] = getNormCounts(element, t);
+    }
+  }
+}
+
 /** Returns the corrected intensity.
  *
  * This method returns the corrected intensity calculated from the supplied
@@ -677,15 +726,18 @@ double PoldiAutoCorrelationCore::getTofFromIndex(int index) const {
  */
 double PoldiAutoCorrelationCore::getSumOfCounts(
     int timeBinCount, const std::vector<int> &detectorElements) const {
-  double sum = 0.0;
+  /* Each element is summed on its own, the sums are then added up in order so
+   * that the result does not depend on the number of threads. */
+  std::vector<double> elementSums(detectorElements.size(), 0.0);
 
-  for (int t = 0; t < timeBinCount; ++t) {
-    for (auto detectorElement : detectorElements) {
-      sum += getCounts(detectorElement, t);
-    }
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < static_cast<int>(detectorElements.size()); ++i) {
+    const auto &counts = m_countData->y(detectorElements[i]);
+    elementSums[i] = std::accumulate(counts.begin(),
+                                     counts.begin() + timeBinCount, 0.0);
   }
 
-  return sum;
+  return std::accumulate(elementSums.begin(), elementSums.end(), 0.0);
 }
 
 } // namespace Poldi
@@ -251,6 +251,24 @@ public:
     TS_ASSERT_EQUALS(autoCorrelationCore.getNormCounts(1, 1), 1.0);
   }
 
+  void testfillCountTables() {
+    Workspace2D_sptr testWorkspace =
+        WorkspaceCreationHelper::create2DWorkspaceWhereYIsWorkspaceIndex(3, 2);
+
+    TestablePoldiAutoCorrelationCore autoCorrelationCore(m_log);
+    autoCorrelationCore.setCountData(testWorkspace);
+    autoCorrelationCore.setNormCountData(testWorkspace);
+    autoCorrelationCore.m_timeBinCount = 2;
+    autoCorrelationCore.m_detectorElements = std::vector<int>{2, 0};
+
+    autoCorrelationCore.fillCountTables();
+
+    TS_ASSERT_EQUALS(autoCorrelationCore.m_countTable,
+                     std::vector<double>({2.0, 2.0, 0.0, 0.0}));
+    TS_ASSERT_EQUALS(autoCorrelationCore.m_normCountTable,
+                     std::vector<double>({2.0, 2.0, 1.0, 1.0}));
+  }
+
   void testgetSumOfCounts() {
     Workspace2D_sptr testWorkspace =
         WorkspaceCreationHelper::create2DWorkspaceWhereYIsWorkspaceIndex(2, 2);
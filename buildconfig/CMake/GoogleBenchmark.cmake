@@ -0,0 +1,48 @@
+# Provide the Google Benchmark library for the framework benchmarks
+# GBENCHMARK_LIBRARIES The libraries to link a benchmark executable against
+
+set (gbenchmark_version "1.8.3" CACHE INTERNAL "")
+
+option(USE_SYSTEM_GBENCHMARK "Use the system installed Google Benchmark - v${gbenchmark_version}?" OFF)
+
+if(USE_SYSTEM_GBENCHMARK)
+  message(STATUS "Using system Google Benchmark")
+  find_package(benchmark ${gbenchmark_version} REQUIRED)
+else()
+  message(STATUS "Using Google Benchmark in ExternalProject")
+
+  # Hardware counters (--benchmark_perf_counters) need libpfm on Linux
+  find_library(PFM_LIBRARY pfm)
+  if(PFM_LIBRARY AND ${CMAKE_SYSTEM_NAME} STREQUAL "Linux")
+    set(BENCHMARK_ENABLE_LIBPFM ON CACHE BOOL "" FORCE)
+  endif()
+  mark_as_advanced(PFM_LIBRARY)
+  set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+  set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+  set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+
+  # Download and unpack Google Benchmark at configure time
+  configure_file(${CMAKE_SOURCE_DIR}/buildconfig/CMake/GoogleBenchmark.in
+                 ${CMAKE_BINARY_DIR}/googlebenchmark-download/CMakeLists.txt @ONLY)
+  execute_process(COMMAND ${CMAKE_COMMAND} -G "${CMAKE_GENERATOR}" -DCMAKE_SYSTEM_VERSION=${CMAKE_SYSTEM_VERSION} .
+                  RESULT_VARIABLE result
+                  WORKING_DIRECTORY ${CMAKE_BINARY_DIR}/googlebenchmark-download )
+  if(result)
+    message(FATAL_ERROR "CMake step for Google Benchmark failed: ${result}")
+  endif()
+  execute_process(COMMAND ${CMAKE_COMMAND} --build .
+                  RESULT_VARIABLE result
+                  WORKING_DIRECTORY ${CMAKE_BINARY_DIR}/googlebenchmark-download )
+  if(result)
+    message(FATAL_ERROR "Build step for Google Benchmark failed: ${result}")
+  endif()
+
+  # Defines the benchmark and benchmark_main targets
+  add_subdirectory(${CMAKE_BINARY_DIR}/googlebenchmark-src
+                   ${CMAKE_BINARY_DIR}/googlebenchmark-build
+                   EXCLUDE_FROM_ALL)
+  set_target_properties(benchmark benchmark_main
+                        PROPERTIES FOLDER "Benchmarks/googlebenchmark")
+endif()
+
+set(GBENCHMARK_LIBRARIES benchmark::benchmark)